@@ -13,60 +13,58 @@ void alymova::inputProcess(std::istream& in, list_pair_t& list)
     {
       list_int.push_back(num);
     }
-    pair_t p(name, list_int);
-    list.push_back(p);
+    list.push_back(pair_t(name, std::move(list_int)));
     in.clear(in.rdstate() ^ std::ios_base::failbit);
   }
 }
 
-void alymova::outputProcessOne(std::ostream& out, const list_pair_t& list, size_t i)
+alymova::list_int_t alymova::outputColumns(std::ostream& out, const list_pair_t& list)
 {
-  auto it = list.cbegin();
-  while ((*it).second.size() <= i)
-  {
-    ++it;
-  }
-  const list_int_t list_now = (*it).second;
-  auto list_now_it = list_now.cbegin();
-  getIIterator(list_now_it, i);
-  out << *list_now_it;
-  ++it;
-  for (; it != list.cend(); ++it)
+  using cursor_t = std::pair< ConstIterator< size_t >, ConstIterator< size_t > >;
+  List< cursor_t > cursors;
+  for (auto it = list.cbegin(); it != list.cend(); ++it)
   {
-    const list_int_t list_now = (*it).second;
-    if (list_now.size() > i)
+    if (!(*it).second.empty())
     {
-      auto list_now_it = (*it).second.cbegin();
-      getIIterator(list_now_it, i);
-      out << " ";
-      out << *list_now_it;
+      cursors.push_back(cursor_t((*it).second.cbegin(), (*it).second.cend()));
     }
   }
-}
-
-alymova::list_int_t alymova::countSums(const list_pair_t& list)
-{
   list_int_t sums;
-  size_t max_size = findMaxListSize(list);
-  for (size_t i = 0; i < max_size; ++i)
+  bool is_overflow = false;
+  while (!cursors.empty())
   {
     size_t sum_now = 0;
-    for (auto it = list.cbegin(); it != list.cend(); ++it)
+    bool is_first = true;
+    for (auto it = cursors.begin(); it != cursors.end();)
     {
-      const list_int_t list_now = (*it).second;
-      if (list_now.size() > i)
+      if (!is_first)
+      {
+        out << " ";
+      }
+      is_first = false;
+      size_t num = *((*it).first);
+      out << num;
+      if (isOverflowSumInt(sum_now, num))
       {
-        auto list_now_it = list_now.cbegin();
-        getIIterator(list_now_it, i);
-        if (isOverflowSumInt(sum_now, *list_now_it))
-        {
-          throw std::logic_error("Summation is incorrect");
-        }
-        sum_now += (*list_now_it);
+        is_overflow = true;
+      }
+      sum_now += num;
+      if (++(*it).first == (*it).second)
+      {
+        it = cursors.erase(it);
+      }
+      else
+      {
+        ++it;
       }
     }
+    out << "\n";
     sums.push_back(sum_now);
   }
+  if (is_overflow)
+  {
+    throw std::logic_error("Summation is incorrect");
+  }
   return sums;
 }
 
@@ -109,12 +107,3 @@ bool alymova::isOverflowSumInt(size_t a, size_t b)
 {
   return (b > std::numeric_limits< size_t >::max() - a);
 }
-
-template< typename T >
-void alymova::getIIterator(ConstIterator< T >& it, size_t i)
-{
-  for (size_t j = 0; j < i; ++j)
-  {
-    ++it;
-  }
-}
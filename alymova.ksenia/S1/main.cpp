@@ -18,18 +18,12 @@ int main()
     }
     outputListString(std::cout, list);
     std::cout << "\n";
-    size_t max_size = findMaxListSize(list);
-    if (max_size == 0)
+    list_int_t sums = outputColumns(std::cout, list);
+    if (sums.empty())
     {
       std::cout << "0\n";
       return 0;
     }
-    for (size_t i = 0; i < max_size; ++i)
-    {
-      outputProcessOne(std::cout, list, i);
-      std::cout << "\n";
-    }
-    list_int_t sums = countSums(list);
     outputListInt(std::cout, sums);
     std::cout << "\n";
   }
@@ -1,8 +1,9 @@
 #include <iostream>
-#include <fstream>
+#include <memory>
 #include <string>
 #include <cstddef>
 #include <stdexcept>
+#include <input-buffer.hpp>
 #include <queue.hpp>
 #include <stack.hpp>
 #include "postfix.hpp"
@@ -14,31 +15,38 @@ int main(int argc, char** argv)
     std::cerr << "Incorrect arguments\n";
     return 1;
   }
-  std::istream* input = &std::cin;
-  std::ifstream file;
-  if (argc == 2)
+  try
   {
-    file.open(argv[1]);
-    if (!file.is_open())
+    std::unique_ptr< alymova::InputBuffer > input;
+    if (argc == 2)
     {
-      std::cerr << "Incorrect file\n";
-      return 1;
+      input.reset(new alymova::InputBuffer(argv[1]));
+      if (!input->is_open())
+      {
+        std::cerr << "Incorrect file\n";
+        return 1;
+      }
     }
-    input = &file;
-  }
-  try
-  {
+    else
+    {
+      input.reset(new alymova::InputBuffer(std::cin));
+    }
+    alymova::TextReader reader(input->begin(), input->end());
     alymova::Stack< long long int > res;
-    while (!(*input).eof())
+    alymova::Stack< alymova::detail::Opcode > operators;
+    alymova::Stack< long long int > operands;
+    alymova::Postfix postfix;
+    alymova::StringView line;
+    std::string s;
+    while (reader.get_line(line))
     {
-      std::string s;
-      std::getline(*input, s);
-      if (s.empty())
+      if (line.size == 0)
       {
         continue;
       }
-      alymova::Postfix postfix(s);
-      res.push(postfix());
+      s.assign(line.data, line.size);
+      postfix.assign(s, operators);
+      res.push(postfix(operands));
     }
     if (!res.empty())
     {
@@ -1,37 +1,42 @@
 #include "postfix.hpp"
 #include <string>
+#include <stdexcept>
 #include <stack.hpp>
-#include "postfixProcess.hpp"
 
 alymova::Postfix::Postfix(const std::string& s):
-  postfix_()
+  code_(),
+  number_error_()
 {
-  Stack< std::string > stack;
-  std::string s_local = s;
-  while (!s_local.empty())
+  Stack< detail::Opcode > operators;
+  assign(s, operators);
+}
+void alymova::Postfix::assign(const std::string& s, Stack< detail::Opcode >& stack)
+{
+  using detail::Opcode;
+  code_.clear();
+  number_error_ = nullptr;
+  stack.clear();
+  size_t pos = 0;
+  while (pos < s.size())
   {
-    std::string now;
-    size_t space = s_local.find(" ");
-    if (space == std::string::npos)
-    {
-      now = s_local;
-      space = s_local.size() - 1;
-    }
-    else
-    {
-      now = s_local.substr(0, space);
-    }
-    s_local = s_local.substr(space + 1);
+    size_t space = s.find(' ', pos);
+    size_t end = (space == std::string::npos) ? s.size() : space;
+    size_t len = end - pos;
+    Opcode code = Opcode::Number;
 
-    if (now == "(")
+    if (len == 1 && s[pos] == '(')
     {
-      stack.push(now);
+      stack.push(Opcode::Bracket);
     }
-    else if (now == ")")
+    else if (len == 1 && s[pos] == ')')
     {
-      while (stack.top() != "(")
+      if (stack.empty())
       {
-        postfix_.push(stack.top());
+        throw std::logic_error("Incorrect expression");
+      }
+      while (stack.top() != Opcode::Bracket)
+      {
+        code_.push_back({stack.top(), 0});
         stack.pop();
         if (stack.empty())
         {
@@ -40,97 +45,111 @@ alymova::Postfix::Postfix(const std::string& s):
       }
       stack.pop();
     }
-    else if (detail::isOperation(now))
+    else if (detail::isOperation(s, pos, len, code))
     {
-      if (!stack.empty())
+      while (!stack.empty() && detail::haveNotLessPriority(code, stack.top()))
       {
-        while (detail::haveNotLessPriority(now, stack.top()))
-        {
-          postfix_.push(stack.top());
-          stack.pop();
-          if (stack.empty())
-          {
-            break;
-          }
-        }
+        code_.push_back({stack.top(), 0});
+        stack.pop();
       }
-      stack.push(now);
+      stack.push(code);
     }
     else
     {
-      postfix_.push(now);
+      try
+      {
+        code_.push_back({Opcode::Number, std::stoll(s.substr(pos, len))});
+      }
+      catch (const std::logic_error&)
+      {
+        if (!number_error_)
+        {
+          number_error_ = std::current_exception();
+        }
+        code_.push_back({Opcode::Invalid, 0});
+      }
     }
+    pos = end + 1;
   }
   while (!stack.empty())
   {
-    if (stack.top() == "(")
+    if (stack.top() == Opcode::Bracket)
     {
       throw std::logic_error("Incorrect expression");
     }
-    postfix_.push(stack.top());
+    code_.push_back({stack.top(), 0});
     stack.pop();
   }
 }
-long long int alymova::Postfix::operator()()
+long long int alymova::Postfix::operator()() const
+{
+  Stack< long long int > operands;
+  return (*this)(operands);
+}
+long long int alymova::Postfix::operator()(Stack< long long int >& stack) const
 {
-  Stack< long long int > stack;
-  Queue< std::string > copy(postfix_);
-  while (!copy.empty())
+  using detail::Opcode;
+  stack.clear();
+  for (size_t i = 0; i < code_.size(); i++)
   {
-    if (detail::isOperation(copy.front()))
+    const detail::Instruction& instruction = code_[i];
+    if (instruction.code == Opcode::Number)
     {
-      if (stack.size() < 2)
+      stack.push(instruction.value);
+      continue;
+    }
+    if (instruction.code == Opcode::Invalid)
+    {
+      std::rethrow_exception(number_error_);
+    }
+    if (stack.size() < 2)
+    {
+      throw std::logic_error("Incorrect expression");
+    }
+    long long int item2 = stack.top();
+    stack.pop();
+    long long int item1 = stack.top();
+    stack.pop();
+    switch (instruction.code)
+    {
+    case Opcode::Add:
+      if (isOverflowAddition(item1, item2))
       {
-        throw std::logic_error("Incorrect expression");
+        throw std::overflow_error("Addition overflow");
       }
-      long long int item2 = stack.top();
-      stack.pop();
-      long long int item1 = stack.top();
-      stack.pop();
-      switch ((copy.front())[0])
+      stack.push(item1 + item2);
+      break;
+    case Opcode::Substract:
+      if (isOverflowSubstraction(item1, item2))
       {
-      case '+':
-        if (isOverflowAddition(item1, item2))
-        {
-          throw std::overflow_error("Addition overflow");
-        }
-        stack.push(item1 + item2);
-        break;
-      case '-':
-        if (isOverflowSubstraction(item1, item2))
-        {
-          throw std::overflow_error("Substraction overflow");
-        }
-        stack.push(item1 - item2);
-        break;
-      case '*':
-        if (isOverflowMulti(item1, item2))
-        {
-          throw std::overflow_error("Multiplication overflow");
-        }
-        stack.push(item1 * item2);
-        break;
-      case '/':
-        if (item2 == 0)
-        {
-          throw std::logic_error("Division by 0");
-        }
-        stack.push(item1 / item2);
-        break;
-      case '%':
-        if (item2 == 0)
-        {
-          throw std::logic_error("Division by 0");
-        }
-        stack.push(mod(item1, item2));
-        break;
+        throw std::overflow_error("Substraction overflow");
       }
+      stack.push(item1 - item2);
+      break;
+    case Opcode::Multiply:
+      if (isOverflowMulti(item1, item2))
+      {
+        throw std::overflow_error("Multiplication overflow");
+      }
+      stack.push(item1 * item2);
+      break;
+    case Opcode::Divide:
+      if (item2 == 0)
+      {
+        throw std::logic_error("Division by 0");
+      }
+      stack.push(item1 / item2);
+      break;
+    case Opcode::Mod:
+      if (item2 == 0)
+      {
+        throw std::logic_error("Division by 0");
+      }
+      stack.push(mod(item1, item2));
+      break;
+    default:
+      throw std::logic_error("Incorrect expression");
     }
-    else
-    {
-      stack.push(std::stoll(copy.front()));
-    }
-    copy.pop();
   }
   if (stack.size() != 1)
   {
@@ -141,39 +160,42 @@ long long int alymova::Postfix::operator()()
 alymova::Postfix alymova::Postfix::operator+(const Postfix& other)
 {
   Postfix copy(*this);
-  copy.push_operator(other, "+");
+  copy.push_operator(other, detail::Opcode::Add);
   return copy;
 }
 alymova::Postfix alymova::Postfix::operator-(const Postfix& other)
 {
   Postfix copy(*this);
-  copy.push_operator(other, "-");
+  copy.push_operator(other, detail::Opcode::Substract);
   return copy;
 }
 alymova::Postfix alymova::Postfix::operator*(const Postfix& other)
 {
   Postfix copy(*this);
-  copy.push_operator(other, "*");
+  copy.push_operator(other, detail::Opcode::Multiply);
   return copy;
 }
 alymova::Postfix alymova::Postfix::operator/(const Postfix& other)
 {
   Postfix copy(*this);
-  copy.push_operator(other, "/");
+  copy.push_operator(other, detail::Opcode::Divide);
   return copy;
 }
 alymova::Postfix alymova::Postfix::operator%(const Postfix& other)
 {
   Postfix copy(*this);
-  copy.push_operator(other, "%");
+  copy.push_operator(other, detail::Opcode::Mod);
   return copy;
 }
-void alymova::Postfix::push_operator(Postfix other, std::string operation)
+void alymova::Postfix::push_operator(const Postfix& other, detail::Opcode operation)
 {
-  while (!other.postfix_.empty())
+  if (!number_error_)
+  {
+    number_error_ = other.number_error_;
+  }
+  for (size_t i = 0; i < other.code_.size(); i++)
   {
-    postfix_.push(other.postfix_.front());
-    other.postfix_.pop();
+    code_.push_back(other.code_[i]);
   }
-  postfix_.push(operation);
+  code_.push_back({operation, 0});
 }
@@ -1,7 +1,10 @@
 #ifndef POSTFIX_HPP
 #define POSTFIX_HPP
 #include <string>
-#include <queue.hpp>
+#include <exception>
+#include <array.hpp>
+#include <stack.hpp>
+#include "postfixProcess.hpp"
 
 namespace alymova
 {
@@ -10,16 +13,19 @@ namespace alymova
     Postfix() = default;
     Postfix(const std::string& s);
 
-    long long int operator()();
+    void assign(const std::string& s, Stack< detail::Opcode >& operators);
+    long long int operator()() const;
+    long long int operator()(Stack< long long int >& operands) const;
     Postfix operator+(const Postfix& other);
     Postfix operator-(const Postfix& other);
     Postfix operator*(const Postfix& other);
     Postfix operator/(const Postfix& other);
     Postfix operator%(const Postfix& other);
   private:
-    Queue< std::string > postfix_;
+    Array< detail::Instruction > code_;
+    std::exception_ptr number_error_;
 
-    void push_operator(Postfix other, std::string operation);
+    void push_operator(const Postfix& other, detail::Opcode operation);
   };
 }
 #endif
@@ -36,15 +36,15 @@ bool alymova::isOverflowMulti(long long int lhs, long long int rhs)
 {
   const long long int max_multi = std::numeric_limits< long long int >::max();
   const long long int min_multi = std::numeric_limits< long long int >::min();
-  if ((lhs > 0 && rhs > 0) || (lhs < 0 && rhs < 0))
+  if (lhs == 0 || rhs == 0)
   {
-    return (std::abs(max_multi / lhs) < std::abs(rhs));
+    return false;
   }
-  else
+  if ((lhs > 0) == (rhs > 0))
   {
-    return (std::abs(min_multi / lhs) < std::abs(rhs));
+    return (lhs > 0) ? (lhs > max_multi / rhs) : (lhs < max_multi / rhs);
   }
-  return false;
+  return (lhs > 0) ? (rhs < min_multi / lhs) : (lhs < min_multi / rhs);
 }
 long long int alymova::mod(long long int item1, long long int item2)
 {
@@ -59,23 +59,37 @@ long long int alymova::mod(long long int item1, long long int item2)
   }
   return item1 - quot * item2;
 }
-bool alymova::detail::haveNotLessPriority(const std::string& token, const std::string& top)
+bool alymova::detail::haveNotLessPriority(Opcode token, Opcode top) noexcept
 {
-  if (token == "*" || token == "/" || token == "%")
+  if (token == Opcode::Multiply || token == Opcode::Divide || token == Opcode::Mod)
   {
-    return (top == "*" || top == "/" || top == "%");
+    return (top == Opcode::Multiply || top == Opcode::Divide || top == Opcode::Mod);
   }
-  return isOperation(top);
+  return top != Opcode::Bracket;
 }
-bool alymova::detail::isOperation(const std::string& token)
+bool alymova::detail::isOperation(const std::string& s, size_t pos, size_t len, Opcode& code) noexcept
 {
-  const std::string operations[5] = {"+", "-", "*", "/", "%"};
-  for (std::string s: operations)
+  if (len != 1)
+  {
+    return false;
+  }
+  switch (s[pos])
   {
-    if (token == s)
-    {
-      return true;
-    }
+  case '+':
+    code = Opcode::Add;
+    return true;
+  case '-':
+    code = Opcode::Substract;
+    return true;
+  case '*':
+    code = Opcode::Multiply;
+    return true;
+  case '/':
+    code = Opcode::Divide;
+    return true;
+  case '%':
+    code = Opcode::Mod;
+    return true;
   }
   return false;
 }
@@ -1,7 +1,7 @@
 #ifndef POSTFIX_PROCESS_HPP
 #define POSTFIX_PROCESS_HPP
 #include <string>
-#include <queue.hpp>
+#include <cstddef>
 
 namespace alymova
 {
@@ -12,8 +12,25 @@ namespace alymova
 
   namespace detail
   {
-    bool haveNotLessPriority(const std::string& token, const std::string& top);
-    bool isOperation(const std::string& token);
+    enum class Opcode: unsigned char
+    {
+      Number,
+      Add,
+      Substract,
+      Multiply,
+      Divide,
+      Mod,
+      Bracket,
+      Invalid
+    };
+    struct Instruction
+    {
+      Opcode code;
+      long long int value;
+    };
+
+    bool haveNotLessPriority(Opcode token, Opcode top) noexcept;
+    bool isOperation(const std::string& s, size_t pos, size_t len, Opcode& code) noexcept;
   }
 }
 #endif
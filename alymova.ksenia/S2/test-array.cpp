@@ -100,3 +100,43 @@ BOOST_AUTO_TEST_CASE(test_emplace)
   BOOST_TEST(array3.size() == 11);
   BOOST_TEST(array3.back() == "12");
 }
+BOOST_AUTO_TEST_CASE(test_growth)
+{
+  using array_t = alymova::Array< long long int >;
+  array_t array1;
+  for (long long int i = 0; i < 8; i++)
+  {
+    array1.push_back(i);
+  }
+  for (int i = 0; i < 5; i++)
+  {
+    array1.pop_front();
+  }
+  for (long long int i = 8; i < 40; i++)
+  {
+    array1.push_back(i);
+  }
+  BOOST_TEST(array1.size() == 35);
+  BOOST_TEST(array1.front() == 5);
+  BOOST_TEST(array1.back() == 39);
+
+  array_t array2(array1);
+  for (long long int i = 5; i < 40; i++)
+  {
+    BOOST_TEST(array2.front() == i);
+    array2.pop_front();
+  }
+  BOOST_TEST(array2.empty());
+
+  using strings_t = alymova::Array< std::string >;
+  strings_t array3;
+  for (int i = 0; i < 25; i++)
+  {
+    array3.push_back(std::string(20, 'a' + i));
+  }
+  strings_t array4(array3);
+  array4.push_back(array4.front());
+  BOOST_TEST(array4.size() == 26);
+  BOOST_TEST(array4.back() == std::string(20, 'a'));
+  BOOST_TEST(array3.back() == std::string(20, 'y'));
+}
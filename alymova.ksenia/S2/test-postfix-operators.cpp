@@ -1,6 +1,7 @@
 #include <boost/test/unit_test.hpp>
 #include <string>
 #include <stdexcept>
+#include <limits>
 #include "postfix.hpp"
 #include "postfixProcess.hpp"
 
@@ -42,3 +43,65 @@ BOOST_AUTO_TEST_CASE(test_operators)
   BOOST_TEST(p3() == 3);
   BOOST_TEST(p3() == mod(p5(), p1()));
 }
+BOOST_AUTO_TEST_CASE(test_multiplication_overflow)
+{
+  using namespace alymova;
+  const long long int max = std::numeric_limits< long long int >::max();
+  const long long int min = std::numeric_limits< long long int >::min();
+  BOOST_TEST(!isOverflowMulti(0, 5));
+  BOOST_TEST(!isOverflowMulti(5, 0));
+  BOOST_TEST(!isOverflowMulti(1, -5));
+  BOOST_TEST(!isOverflowMulti(-1, max));
+  BOOST_TEST(isOverflowMulti(-1, min));
+  BOOST_TEST(isOverflowMulti(max / 2 + 1, 2));
+  BOOST_TEST(!isOverflowMulti(min / 2, 2));
+  BOOST_TEST(isOverflowMulti(min / 2 - 1, 2));
+  BOOST_TEST(Postfix("0 * ( 3 - 5 )")() == 0);
+  BOOST_TEST(Postfix("( 1 - 2 ) * 7")() == -7);
+}
+BOOST_AUTO_TEST_CASE(test_reuse)
+{
+  using namespace alymova;
+  Stack< detail::Opcode > operators;
+  Stack< long long int > operands;
+  Postfix postfix;
+  postfix.assign("( 1 + 2 ) * 3", operators);
+  BOOST_TEST(postfix(operands) == 9);
+  postfix.assign("7 - 10 % 4", operators);
+  BOOST_TEST(postfix(operands) == 5);
+  postfix.assign("1 +", operators);
+  BOOST_CHECK_THROW(postfix(operands), std::logic_error);
+  postfix.assign("42", operators);
+  BOOST_TEST(postfix(operands) == 42);
+}
+BOOST_AUTO_TEST_CASE(test_invalid_number)
+{
+  using namespace alymova;
+  try
+  {
+    Postfix p("( 1 + abc");
+    BOOST_FAIL("unclosed bracket was accepted");
+  }
+  catch (const std::logic_error& e)
+  {
+    BOOST_TEST(std::string(e.what()) == "Incorrect expression");
+  }
+
+  Postfix p1("1 + abc");
+  BOOST_CHECK_THROW(p1(), std::invalid_argument);
+  Postfix p2("1 + + abc");
+  try
+  {
+    p2();
+    BOOST_FAIL("missing operand was accepted");
+  }
+  catch (const std::logic_error& e)
+  {
+    BOOST_TEST(std::string(e.what()) == "Incorrect expression");
+  }
+
+  Postfix p3("2");
+  BOOST_CHECK_THROW((p3 + p1)(), std::invalid_argument);
+  p1 = Postfix("1 + 2");
+  BOOST_TEST(p1() == 3);
+}
@@ -1,29 +1,19 @@
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <exception>
-#include <functional>
 #include <tree/tree-2-3.hpp>
 #include "utils.hpp"
 
 int main(int argc, char** argv)
 {
   using namespace alymova;
-  using Dataset_t = TwoThreeTree< size_t, std::string, std::less< size_t > >;
-  using CompositeDataset_t = TwoThreeTree< std::string, Dataset_t, std::less< std::string > >;
-  using CommandDataset_t = TwoThreeTree<
-    std::string,
-    std::function< void(CompositeDataset_t&) >,
-    std::less< std::string >
-  >;
 
   if (argc != 2)
   {
     std::cerr << "<INCORRECT ARGUMENTS>\n";
     return 1;
   }
-  std::ifstream file;
-  file.open(argv[1]);
+  InputBuffer file(argv[1]);
   if (!file.is_open())
   {
     std::cerr << "<INCORRECT FILE>\n";
@@ -32,12 +22,12 @@ int main(int argc, char** argv)
 
   try
   {
-    CompositeDataset_t dataset_comp = readDictionaryFile(file);
-    file.clear();
+    TextReader reader(file.begin(), file.end());
+    CompositeDataset_t dataset_comp = readDictionaryFile(reader);
 
-    CommandDataset_t dataset_commands = complectCommands();
+    CommandDataset_t dataset_commands = complectCommands(std::cin);
     std::string command;
-    while ((std::cin >> command))
+    while (std::cin >> command)
     {
       dataset_commands.at(command)(dataset_comp);
       if (command == "print")
@@ -1,5 +1,14 @@
 #include <boost/test/unit_test.hpp>
+#include <string>
+#include <cstring>
+#include <sstream>
+#include <unistd.h>
+#include <input-buffer.hpp>
 #include <tree/tree-2-3.hpp>
+#include <tree/tree-merge.hpp>
+#include <list/list.hpp>
+#include <list/iterators.hpp>
+#include "utils.hpp"
 
 BOOST_AUTO_TEST_CASE(test_constructors_operators)
 {
@@ -200,6 +209,74 @@ BOOST_AUTO_TEST_CASE(test_lookup)
   BOOST_TEST((tree.lower_bound(1) == tree.end()));
   BOOST_TEST((tree.upper_bound(1) == tree.end()));
 }
+BOOST_AUTO_TEST_CASE(test_bounds)
+{
+  using Tree = alymova::TwoThreeTree< size_t, std::string, std::less< size_t > >;
+
+  Tree tree;
+  for (size_t i = 0; i < 200; i++)
+  {
+    tree[(i * 73) % 200 * 2] = std::to_string(i);
+  }
+  BOOST_TEST(tree.size() == 200);
+  for (size_t key = 0; key < 402; key++)
+  {
+    size_t lower = (key + 1) / 2 * 2;
+    size_t upper = key / 2 * 2 + 2;
+    if (lower < 400)
+    {
+      BOOST_TEST(tree.lower_bound(key)->first == lower);
+    }
+    else
+    {
+      BOOST_TEST((tree.lower_bound(key) == tree.end()));
+    }
+    if (upper < 400)
+    {
+      BOOST_TEST(tree.upper_bound(key)->first == upper);
+    }
+    else
+    {
+      BOOST_TEST((tree.upper_bound(key) == tree.end()));
+    }
+  }
+
+  tree.clear();
+  BOOST_TEST((tree.find(0) == tree.end()));
+  tree[5] = "five";
+  BOOST_TEST(tree.size() == 1);
+  BOOST_TEST(tree.lower_bound(0)->second == "five");
+}
+BOOST_AUTO_TEST_CASE(test_transparent_lookup)
+{
+  using Tree = alymova::TwoThreeTree< std::string, size_t, std::less<> >;
+
+  Tree tree;
+  for (size_t i = 0; i < 100; i++)
+  {
+    tree.emplace("key" + std::to_string(i), i);
+  }
+  const char* text = "key42 key7 missing";
+  alymova::StringView first{text, 5};
+  alymova::StringView second{text + 6, 4};
+  alymova::StringView third{text + 11, 7};
+
+  BOOST_TEST(tree.at(first) == 42);
+  BOOST_TEST(tree.find(second)->second == 7);
+  BOOST_TEST(tree.count(second) == 1);
+  BOOST_TEST(tree.count(third) == 0);
+  BOOST_TEST((tree.find(third) == tree.end()));
+  BOOST_CHECK_THROW(tree.at(third), std::out_of_range);
+  BOOST_TEST(tree.at("key99") == 99);
+
+  const Tree& ctree = tree;
+  BOOST_TEST(ctree.find(first)->first == "key42");
+  for (size_t i = 0; i < 100; i++)
+  {
+    BOOST_TEST(tree.find("key" + std::to_string(i))->second == i);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_empace_hint)
 {
   using Tree = alymova::TwoThreeTree< int, std::string, std::less< int > >;
@@ -448,3 +525,153 @@ BOOST_AUTO_TEST_CASE(test_erase)
   BOOST_TEST(tree.size() == 0);
   BOOST_TEST((it == tree.end()));
 }
+BOOST_AUTO_TEST_CASE(test_sorted_range_constructor)
+{
+  using Tree = alymova::TwoThreeTree< size_t, std::string, std::less< size_t > >;
+
+  alymova::List< std::pair< size_t, std::string > > sorted;
+  for (size_t i = 0; i < 100; i++)
+  {
+    sorted.push_back({i * 2, std::to_string(i)});
+  }
+  Tree tree1(sorted.begin(), sorted.end());
+  BOOST_TEST(tree1.size() == 100);
+  size_t expected = 0;
+  for (auto it = tree1.cbegin(); it != tree1.cend(); it++, expected += 2)
+  {
+    BOOST_TEST(it->first == expected);
+  }
+  BOOST_TEST((--tree1.end())->first == 198);
+  tree1.insert({51, "inserted"});
+  tree1.erase(0);
+  BOOST_TEST(tree1.size() == 100);
+  BOOST_TEST(tree1.at(51) == "inserted");
+  BOOST_TEST(tree1.cbegin()->first == 2);
+
+  alymova::List< std::pair< size_t, std::string > > unsorted = {{3, "c"}, {1, "a"}, {2, "b"}, {1, "d"}};
+  Tree tree2(unsorted.begin(), unsorted.end());
+  BOOST_TEST((tree2 == Tree({{1, "a"}, {2, "b"}, {3, "c"}})));
+}
+BOOST_AUTO_TEST_CASE(test_rank_select)
+{
+  using Tree = alymova::TwoThreeTree< size_t, std::string, std::less< size_t > >;
+
+  alymova::List< std::pair< size_t, std::string > > sorted;
+  for (size_t i = 0; i < 50; i++)
+  {
+    sorted.push_back({i * 2, std::to_string(i)});
+  }
+  Tree tree(sorted.begin(), sorted.end());
+  for (size_t i = 0; i < 30; i++)
+  {
+    tree.emplace(i * 4 + 1, "odd");
+  }
+  for (size_t i = 0; i < 100; i += 3)
+  {
+    tree.erase(i);
+  }
+  BOOST_TEST(tree.size() == 55);
+  BOOST_TEST(tree.nth(0)->first == 1);
+  BOOST_TEST(tree.nth(3)->first == 5);
+  BOOST_TEST((tree.nth(55) == tree.end()));
+  BOOST_TEST(tree.rank(0) == 0);
+  BOOST_TEST(tree.rank(6) == 4);
+  BOOST_TEST(tree.rank(1000) == 55);
+  BOOST_TEST(tree.distance(tree.cbegin(), tree.cend()) == 55);
+  BOOST_TEST(tree.distance(tree.find(5), tree.find(10)) == 2);
+
+  const Tree& const_tree = tree;
+  size_t pos = 0;
+  for (auto it = tree.cbegin(); it != tree.cend(); it++, pos++)
+  {
+    BOOST_TEST((const_tree.nth(pos) == it));
+    BOOST_TEST(tree.rank(it->first) == pos);
+    BOOST_TEST(tree.distance(it, tree.cend()) == tree.size() - pos);
+  }
+}
+BOOST_AUTO_TEST_CASE(test_merge)
+{
+  using Tree = alymova::TwoThreeTree< size_t, std::string, std::less< size_t > >;
+  using Pairs = alymova::List< std::pair< size_t, std::string > >;
+
+  Tree tree1({{1, "a"}, {3, "b"}, {5, "c"}});
+  Tree tree2({{2, "d"}, {3, "e"}, {6, "f"}});
+
+  Pairs union_result;
+  alymova::merge_union(tree1.cbegin(), tree1.cend(), tree2.cbegin(), tree2.cend(), std::less< size_t >(),
+    [&union_result](const std::pair< size_t, std::string >& value)
+    {
+      union_result.push_back(value);
+    });
+  BOOST_TEST(union_result.size() == 5);
+  Tree union_tree(union_result.begin(), union_result.end());
+  BOOST_TEST((union_tree == Tree({{1, "a"}, {2, "d"}, {3, "b"}, {5, "c"}, {6, "f"}})));
+
+  Pairs intersection_result;
+  alymova::merge_intersection(tree1.cbegin(), tree1.cend(), tree2.cbegin(), tree2.cend(), std::less< size_t >(),
+    [&intersection_result](const std::pair< size_t, std::string >& value)
+    {
+      intersection_result.push_back(value);
+    });
+  BOOST_TEST((Tree(intersection_result.begin(), intersection_result.end()) == Tree({{3, "b"}})));
+
+  Pairs difference_result;
+  alymova::merge_symmetric_difference(tree1.cbegin(), tree1.cend(), tree2.cbegin(), tree2.cend(),
+    std::less< size_t >(), [&difference_result](const std::pair< size_t, std::string >& value)
+    {
+      difference_result.push_back(value);
+    });
+  Tree difference_tree(difference_result.begin(), difference_result.end());
+  BOOST_TEST((difference_tree == Tree({{1, "a"}, {2, "d"}, {5, "c"}, {6, "f"}})));
+}
+BOOST_AUTO_TEST_CASE(test_print_command)
+{
+  std::istringstream in("first second\n\nmissing");
+  std::ostringstream out;
+  alymova::PrintCommand print{in, out};
+
+  alymova::CompositeDataset_t dicts;
+  dicts["first"] = alymova::Dataset_t({{3, "b"}, {1, "a"}});
+  dicts["second"] = alymova::Dataset_t();
+
+  print(dicts);
+  BOOST_TEST(out.str() == "first 1 a 3 b");
+  out.str("");
+  print(dicts);
+  BOOST_TEST(out.str() == "<EMPTY>");
+  out.str("");
+  BOOST_CHECK_THROW(print(dicts), std::out_of_range);
+  BOOST_CHECK_THROW(print(dicts), std::logic_error);
+  BOOST_TEST(out.str().empty());
+}
+BOOST_AUTO_TEST_CASE(test_union_command_across_lines)
+{
+  std::istringstream in("result\nfirst\n  second");
+  alymova::CompositeDataset_t dicts;
+  dicts["first"] = alymova::Dataset_t({{1, "a"}});
+  dicts["second"] = alymova::Dataset_t({{2, "b"}});
+
+  alymova::UnionCommand{in}(dicts);
+  BOOST_TEST((dicts.at("result") == alymova::Dataset_t({{1, "a"}, {2, "b"}})));
+}
+BOOST_AUTO_TEST_CASE(test_input_buffer_pipe)
+{
+  std::string text = "first 1 a 2 b\n";
+  text += std::string(5000, ' ');
+  text += "second 3 c\n";
+  int fds[2];
+  BOOST_REQUIRE(::pipe(fds) == 0);
+  BOOST_REQUIRE(::write(fds[1], text.data(), text.size()) == static_cast< ssize_t >(text.size()));
+  ::close(fds[1]);
+  std::string path = "/dev/fd/" + std::to_string(fds[0]);
+  alymova::InputBuffer input(path.c_str());
+  ::close(fds[0]);
+
+  BOOST_TEST(input.is_open());
+  BOOST_TEST(std::string(input.begin(), input.end()) == text);
+  alymova::TextReader reader(input.begin(), input.end());
+  alymova::CompositeDataset_t dicts = alymova::readDictionaryFile(reader);
+  BOOST_TEST(dicts.size() == 2);
+  BOOST_TEST((dicts.at("first") == alymova::Dataset_t({{1, "a"}, {2, "b"}})));
+  BOOST_TEST((dicts.at("second") == alymova::Dataset_t({{3, "c"}})));
+}
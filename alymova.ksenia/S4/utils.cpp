@@ -1,23 +1,49 @@
 #include "utils.hpp"
 #include <string>
+#include <utility>
 #include <iostream>
 #include <exception>
+#include <iterator>
+#include <list/list.hpp>
+#include <list/iterators.hpp>
+#include <tree/tree-merge.hpp>
 
 using namespace alymova;
 
+namespace
+{
+  using SortedPairs_t = List< std::pair< size_t, std::string > >;
+
+  struct AppendToList
+  {
+    SortedPairs_t& pairs;
+    void operator()(const std::pair< size_t, std::string >& value)
+    {
+      pairs.push_back(value);
+    }
+  };
+
+  Dataset_t buildDataset(SortedPairs_t& pairs)
+  {
+    return Dataset_t(std::make_move_iterator(pairs.begin()), std::make_move_iterator(pairs.end()));
+  }
+}
+
 void alymova::PrintCommand::operator()(const CompositeDataset_t& dicts)
 {
-  std::string name;
-  in >> name;
+  if (!(in >> name))
+  {
+    throw std::logic_error("<INVALID COMMAND>");
+  }
 
-  Dataset_t dataset = dicts.at(name);
+  const Dataset_t& dataset = dicts.at(name);
   if (dataset.empty())
   {
     out << "<EMPTY>";
     return;
   }
   out << name;
-  for (auto it = dataset.begin(); it != dataset.end(); it++)
+  for (auto it = dataset.cbegin(); it != dataset.cend(); it++)
   {
     out << ' ' << it->first << ' ' << it->second;
   }
@@ -25,78 +51,76 @@ void alymova::PrintCommand::operator()(const CompositeDataset_t& dicts)
 
 void alymova::ComplementCommand::operator()(CompositeDataset_t& dicts)
 {
-  std::string newname, name1, name2;
-  in >> newname >> name1 >> name2;
-
-  Dataset_t dataset1 = dicts.at(name1);
-  Dataset_t dataset2 = dicts.at(name2);
-  for (auto it = dataset1.begin(); it != dataset1.end(); it++)
+  if (!(in >> newname >> name1 >> name2))
   {
-    if (dataset2.count(it->first) == 0)
-    {
-      dataset2.insert({it->first, it->second});
-    }
-    else
-    {
-      dataset2.erase(it->first);
-    }
+    throw std::logic_error("<INVALID COMMAND>");
   }
-  dicts[newname] = dataset2;
+
+  const Dataset_t& dataset1 = dicts.at(name1);
+  const Dataset_t& dataset2 = dicts.at(name2);
+  SortedPairs_t result;
+  merge_symmetric_difference(dataset1.cbegin(), dataset1.cend(), dataset2.cbegin(), dataset2.cend(),
+    std::less< size_t >(), AppendToList{result});
+  dicts[newname] = buildDataset(result);
 }
 
 void alymova::IntersectCommand::operator()(CompositeDataset_t& dicts)
 {
-  std::string newname, name1, name2;
-  in >> newname >> name1 >> name2;
-
-  Dataset_t dataset1 = dicts.at(name1);
-  Dataset_t dataset2 = dicts.at(name2);
-  for (auto it = dataset1.begin(); it != dataset1.end();)
+  if (!(in >> newname >> name1 >> name2))
   {
-    if (dataset2.find(it->first) == dataset2.end())
-    {
-      it = dataset1.erase(it);
-    }
-    else
-    {
-      it++;
-    }
+    throw std::logic_error("<INVALID COMMAND>");
   }
-  dicts[newname] = dataset1;
+
+  const Dataset_t& dataset1 = dicts.at(name1);
+  const Dataset_t& dataset2 = dicts.at(name2);
+  SortedPairs_t result;
+  merge_intersection(dataset1.cbegin(), dataset1.cend(), dataset2.cbegin(), dataset2.cend(),
+    std::less< size_t >(), AppendToList{result});
+  dicts[newname] = buildDataset(result);
 }
 
 void alymova::UnionCommand::operator()(CompositeDataset_t& dicts)
 {
-  std::string newname, name1, name2;
-  in >> newname >> name1 >> name2;
-
-  Dataset_t dataset1 = dicts.at(name1);
-  Dataset_t dataset2 = dicts.at(name2);
-  for (auto it = dataset2.begin(); it != dataset2.end(); it++)
+  if (!(in >> newname >> name1 >> name2))
   {
-    if (dataset1.count(it->first) == 0)
-    {
-      dataset1.insert({it->first, it->second});
-    }
+    throw std::logic_error("<INVALID COMMAND>");
   }
-  dicts[newname] = dataset1;
+
+  const Dataset_t& dataset1 = dicts.at(name1);
+  const Dataset_t& dataset2 = dicts.at(name2);
+  SortedPairs_t result;
+  merge_union(dataset1.cbegin(), dataset1.cend(), dataset2.cbegin(), dataset2.cend(),
+    std::less< size_t >(), AppendToList{result});
+  dicts[newname] = buildDataset(result);
 }
 
-alymova::CompositeDataset_t alymova::readDictionaryFile(std::istream& in)
+alymova::CompositeDataset_t alymova::readDictionaryFile(TextReader& in)
 {
   CompositeDataset_t dataset_comp;
-  std::string name;
+  StringView name{"", 0};
   while (in >> name)
   {
-    Dataset_t dataset;
+    SortedPairs_t pairs;
+    bool sorted = true;
     size_t key;
-    std::string value;
+    StringView value{"", 0};
     while (in.peek() != '\n' && in)
     {
       in >> key >> value;
-      dataset[key] = value;
+      sorted = sorted && (pairs.empty() || pairs.back().first < key);
+      pairs.push_back({key, value.str()});
+    }
+    if (sorted)
+    {
+      dataset_comp[name.str()] = buildDataset(pairs);
+      continue;
+    }
+    Dataset_t dataset;
+    for (auto it = pairs.begin(); it != pairs.end(); it++)
+    {
+      dataset[it->first] = std::move(it->second);
     }
-    dataset_comp[name] = dataset;
+    dataset_comp[name.str()] = std::move(dataset);
   }
   if ((in).fail() && !(in).eof())
   {
@@ -105,13 +129,13 @@ alymova::CompositeDataset_t alymova::readDictionaryFile(std::istream& in)
   return dataset_comp;
 }
 
-alymova::CommandDataset_t alymova::complectCommands()
+alymova::CommandDataset_t alymova::complectCommands(std::istream& in)
 {
   return
   {
-    {"print", PrintCommand{std::cin, std::cout}},
-    {"complement", ComplementCommand{std::cin}},
-    {"intersect", IntersectCommand{std::cin}},
-    {"union", UnionCommand{std::cin}}
+    {"print", PrintCommand{in, std::cout}},
+    {"complement", ComplementCommand{in}},
+    {"intersect", IntersectCommand{in}},
+    {"union", UnionCommand{in}}
   };
 }
@@ -1,42 +1,47 @@
 #ifndef UTILS_HPP
 #define UTILS_HPP
 #include <iostream>
+#include <input-buffer.hpp>
 #include <tree/tree-2-3.hpp>
 
 namespace alymova
 {
   using Dataset_t = TwoThreeTree< size_t, std::string, std::less< size_t > >;
-  using CompositeDataset_t = TwoThreeTree< std::string, Dataset_t, std::less< std::string > >;
+  using CompositeDataset_t = TwoThreeTree< std::string, Dataset_t, std::less<> >;
   using CommandDataset_t = TwoThreeTree<
     std::string,
     std::function< void(CompositeDataset_t&) >,
-    std::less< std::string >
+    std::less<>
   >;
 
   struct PrintCommand
   {
     std::istream& in;
     std::ostream& out;
+    std::string name;
     void operator()(const CompositeDataset_t& dicts);
   };
   struct ComplementCommand
   {
     std::istream& in;
+    std::string newname, name1, name2;
     void operator()(CompositeDataset_t& dicts);
   };
   struct IntersectCommand
   {
     std::istream& in;
+    std::string newname, name1, name2;
     void operator()(CompositeDataset_t& dicts);
   };
   struct UnionCommand
   {
     std::istream& in;
+    std::string newname, name1, name2;
     void operator()(CompositeDataset_t& dicts);
   };
 
-  CompositeDataset_t readDictionaryFile(std::istream& in);
-  CommandDataset_t complectCommands();
+  CompositeDataset_t readDictionaryFile(TextReader& in);
+  CommandDataset_t complectCommands(std::istream& in);
 }
 
 #endif
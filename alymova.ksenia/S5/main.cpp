@@ -1,6 +1,7 @@
 #include <iostream>
-#include <fstream>
 #include <functional>
+#include <utility>
+#include <input-buffer.hpp>
 #include <tree/tree-2-3.hpp>
 #include "tree-sum-functor.hpp"
 
@@ -8,12 +9,12 @@
 template< class Tree, class F >
 struct CallTraverse
 {
-  Tree tree;
-  F (Tree::*traverse)(F);
+  const Tree& tree;
+  F (Tree::*traverse)(F&&) const;
 
-  F operator()(F f)
+  F operator()(F f) const
   {
-    return (tree.*traverse)(f);
+    return (tree.*traverse)(std::move(f));
   }
 };
 
@@ -27,9 +28,8 @@ int main(int args, char** argv)
     std::cerr << "<INCORRECT ARGUMENTS>\n";
     return 1;
   }
-  std::ifstream file;
-  file.open(argv[2]);
-  if (!file.is_open())
+  InputBuffer input(argv[2]);
+  if (!input.is_open())
   {
     std::cerr << "<INCORRECT FILE>\n";
     return 1;
@@ -38,13 +38,14 @@ int main(int args, char** argv)
   try
   {
     DatasetType dataset;
+    TextReader file(input.begin(), input.end());
     while (!file.eof() && !file.fail())
     {
       int key;
-      std::string value;
-      if (file >> key >> value && !value.empty())
+      StringView value{"", 0};
+      if (file >> key >> value && value.size != 0)
       {
-        dataset[key] = value;
+        dataset[key] = value.str();
       }
     }
     if (file.fail() && !file.eof())
@@ -59,14 +60,16 @@ int main(int args, char** argv)
       return 0;
     }
     std::string round = argv[1];
-    TreeSum result;
     TwoThreeTree< std::string, std::function< TreeSum(TreeSum) >, std::less< std::string > > commandset{
       {"ascending", CallTraverse< DatasetType, TreeSum >{dataset, &DatasetType::traverse_lnr}},
       {"descending", CallTraverse< DatasetType, TreeSum >{dataset, &DatasetType::traverse_rnl}},
       {"breadth", CallTraverse< DatasetType, TreeSum >{dataset, &DatasetType::traverse_breadth}}
     };
-    result = commandset.at(round)(result);
-    std::cout << result << '\n';
+    const std::function< TreeSum(TreeSum) >& command = commandset.at(round);
+    TreeSum keys_sum = command(TreeSum(nullptr));
+    std::cout << keys_sum.keys;
+    command(TreeSum(&std::cout));
+    std::cout << '\n';
   }
   catch (const std::exception& e)
   {
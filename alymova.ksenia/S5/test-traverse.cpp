@@ -1,4 +1,6 @@
 #include <boost/test/unit_test.hpp>
+#include <sstream>
+#include <limits>
 #include <tree/tree-2-3.hpp>
 #include "tree-sum-functor.hpp"
 
@@ -47,3 +49,51 @@ BOOST_AUTO_TEST_CASE(test_traverses)
   BOOST_TEST(result3.values.front() == "c");
   result3.values.pop();
 }
+
+BOOST_AUTO_TEST_CASE(test_streaming_sum)
+{
+  using namespace alymova;
+  using Tree = alymova::TwoThreeTree< int, std::string, std::less< int > >;
+
+  Tree tree{{2, "b"}, {1, "a"}, {3, "c"}};
+  std::ostringstream out;
+  TreeSum result = tree.traverse_lnr(TreeSum(&out));
+  BOOST_TEST(result.keys == 6);
+  BOOST_TEST(result.values.empty());
+  BOOST_TEST(out.str() == " a b c");
+
+  TreeSum keys_only = tree.traverse_rnl(TreeSum(nullptr));
+  BOOST_TEST(keys_only.keys == 6);
+  BOOST_TEST(keys_only.values.empty());
+
+  Tree overflow{{std::numeric_limits< int >::max(), "a"}, {1, "b"}};
+  BOOST_CHECK_THROW(overflow.traverse_lnr(TreeSum(nullptr)), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_breadth_iterator)
+{
+  using namespace alymova;
+  using Tree = alymova::TwoThreeTree< int, int, std::less< int > >;
+
+  Tree tree;
+  for (int i = 0; i < 300; i++)
+  {
+    tree.emplace((i * 71) % 300, i);
+  }
+
+  std::ostringstream expected;
+  tree.traverse_breadth([&expected](const std::pair< int, int >& value)
+  {
+    expected << ' ' << value.first;
+  });
+
+  std::ostringstream actual;
+  size_t count = 0;
+  for (auto it = tree.breadth_cbegin(); it != tree.breadth_cend(); it++)
+  {
+    actual << ' ' << it->first;
+    count++;
+  }
+  BOOST_TEST(count == tree.size());
+  BOOST_TEST(actual.str() == expected.str());
+}
@@ -4,17 +4,34 @@
 
 alymova::TreeSum::TreeSum():
   keys(0),
-  values()
+  values(),
+  sink(nullptr),
+  collect(true)
+{}
+
+alymova::TreeSum::TreeSum(std::ostream* out):
+  keys(0),
+  values(),
+  sink(out),
+  collect(false)
 {}
 
 void alymova::TreeSum::operator()(const std::pair< int, std::string >& key_value)
 {
-  if (isOverflowAddition(keys, key_value.first))
+  const long long int sum = static_cast< long long int >(keys) + key_value.first;
+  if (sum > std::numeric_limits< int >::max() || sum < std::numeric_limits< int >::min())
   {
     throw std::logic_error("<SUM OVERFLOW>");
   }
-  keys += key_value.first;
-  values.push(key_value.second);
+  keys = static_cast< int >(sum);
+  if (sink)
+  {
+    *sink << ' ' << key_value.second;
+  }
+  else if (collect)
+  {
+    values.push(key_value.second);
+  }
 }
 std::ostream& alymova::operator<<(std::ostream& out, const TreeSum& object)
 {
@@ -10,8 +10,11 @@ namespace alymova
   {
     int keys;
     Queue< std::string > values;
+    std::ostream* sink;
+    bool collect;
 
     TreeSum();
+    explicit TreeSum(std::ostream* out);
     void operator()(const std::pair< int, std::string >& key_value);
   };
   std::ostream& operator<<(std::ostream& out, const TreeSum& object);
@@ -1,7 +1,11 @@
 #ifndef ARRAY_HPP
 #define ARRAY_HPP
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <new>
 #include <utility>
+#include <type_traits>
 #include <stdexcept>
 #include <cassert>
 
@@ -24,6 +28,8 @@ namespace alymova
     const T& front() const noexcept;
     T& back();
     const T& back() const noexcept;
+    T& operator[](size_t i) noexcept;
+    const T& operator[](size_t i) const noexcept;
     void push_back(const T& value);
     void push_back(T&& value);
     void pop_front() noexcept;
@@ -31,6 +37,7 @@ namespace alymova
     template< typename... Args >
     void emplace_back(Args&&... args);
     void swap(Array< T >& other);
+    void clear() noexcept;
   private:
     T* array_;
     T* begin_;
@@ -38,45 +45,46 @@ namespace alymova
     size_t size_;
     size_t capacity_;
 
-    void clear() noexcept;
+    using is_trivial_t = std::integral_constant< bool, std::is_trivially_copyable< T >::value >;
+
+    static T* allocate(size_t capacity);
+    T* next(T* ptr) const noexcept;
+    void copy_to(T* array_new, std::true_type) const noexcept;
+    void copy_to(T* array_new, std::false_type) const;
+    void relocate(T* array_new, std::true_type) noexcept;
+    void relocate(T* array_new, std::false_type);
+    void destroy() noexcept;
+    void release() noexcept;
   };
 
   template< typename T >
   Array< T >::Array():
-    array_(new T[10]{}),
-    begin_(array_),
-    size_ptr_(array_),
+    array_(nullptr),
+    begin_(nullptr),
+    size_ptr_(nullptr),
     size_(0),
-    capacity_(10)
+    capacity_(0)
   {}
 
   template< typename T >
   Array< T >::Array(const Array< T >& other):
-    array_(new T[10]{}),
+    array_(allocate(other.capacity_)),
     begin_(array_),
     size_ptr_(array_),
-    size_(other.size_),
+    size_(0),
     capacity_(other.capacity_)
   {
     try
     {
-      T* ptr = other.begin_;
-      for (size_t i = 0; i < other.size_; i++)
-      {
-        array_[i] = *ptr;
-        ptr++;
-        if (ptr == other.array_ + other.capacity_)
-        {
-          ptr = other.array_;
-        }
-        size_ptr_++;
-      }
+      other.copy_to(array_, is_trivial_t{});
     }
     catch (...)
     {
-      clear();
+      ::operator delete(array_);
       throw;
     }
+    size_ = other.size_;
+    size_ptr_ = (size_ == capacity_) ? array_ : array_ + size_;
   }
 
   template< typename T >
@@ -91,7 +99,7 @@ namespace alymova
   template< typename T >
   Array< T >::~Array() noexcept
   {
-    clear();
+    release();
   }
 
   template< typename T >
@@ -140,7 +148,7 @@ namespace alymova
   T& Array< T >::back()
   {
     assert(size_ != 0);
-    if (size_ptr_ == array_ && size_ != 0)
+    if (size_ptr_ == array_)
     {
       return *(array_ + capacity_ - 1);
     }
@@ -151,13 +159,29 @@ namespace alymova
   const T& Array< T >::back() const noexcept
   {
     assert(size_ != 0);
-    if (size_ptr_ == array_ && size_ != 0)
+    if (size_ptr_ == array_)
     {
       return *(array_ + capacity_ - 1);
     }
     return *(size_ptr_ - 1);
   }
 
+  template< typename T >
+  T& Array< T >::operator[](size_t i) noexcept
+  {
+    assert(i < size_);
+    size_t tail = array_ + capacity_ - begin_;
+    return (i < tail) ? begin_[i] : array_[i - tail];
+  }
+
+  template< typename T >
+  const T& Array< T >::operator[](size_t i) const noexcept
+  {
+    assert(i < size_);
+    size_t tail = array_ + capacity_ - begin_;
+    return (i < tail) ? begin_[i] : array_[i - tail];
+  }
+
   template< typename T >
   void Array< T >::push_back(const T& value)
   {
@@ -174,14 +198,8 @@ namespace alymova
   void Array< T >::pop_front() noexcept
   {
     assert(size_ != 0);
-    if (begin_ == array_ + capacity_ - 1)
-    {
-      begin_ = array_;
-    }
-    else
-    {
-      begin_++;
-    }
+    begin_->~T();
+    begin_ = next(begin_);
     size_--;
   }
 
@@ -189,11 +207,12 @@ namespace alymova
   void Array< T >::pop_back() noexcept
   {
     assert(size_ != 0);
-    if (size_ptr_ == array_ && size_ != 0)
+    if (size_ptr_ == array_)
     {
       size_ptr_ = array_ + capacity_;
     }
     size_ptr_--;
+    size_ptr_->~T();
     size_--;
   }
 
@@ -201,45 +220,40 @@ namespace alymova
   template< typename... Args >
   void Array< T >::emplace_back(Args&&... args)
   {
-    T* capacity_ptr = array_ + capacity_ - 1;
-    if ((size_ptr_ - 1) == capacity_ptr)
+    if (size_ != capacity_)
     {
-      size_ptr_ = array_;
+      new (size_ptr_) T(std::forward< Args >(args)...);
+      size_ptr_ = next(size_ptr_);
+      size_++;
+      return;
     }
-    if (size_ptr_ == begin_ && size_ != 0)
+    size_t capacity_new = (capacity_ == 0) ? 10 : capacity_ * 2;
+    T* array_new = allocate(capacity_new);
+    try
     {
-      int ratio = 2;
-      T* array_new = new T[capacity_ * 2]{};
-      size_t i = 0;
-      try
-      {
-        for (T* ptr = begin_; ptr != capacity_ptr; ptr++)
-        {
-          array_new[i] = *ptr;
-          i++;
-        }
-        array_new[i] = *capacity_ptr;
-        i++;
-        for (T* ptr = array_; ptr != begin_; ptr++)
-        {
-          array_new[i] = *ptr;
-          i++;
-        }
-      }
-      catch (...)
-      {
-        delete[] array_new;
-        throw;
-      }
-      clear();
-      capacity_ *= ratio;
-      array_ = array_new;
-      begin_ = array_;
-      size_ptr_ = array_ + size_;
+      new (array_new + size_) T(std::forward< Args >(args)...);
+    }
+    catch (...)
+    {
+      ::operator delete(array_new);
+      throw;
+    }
+    try
+    {
+      relocate(array_new, is_trivial_t{});
+    }
+    catch (...)
+    {
+      array_new[size_].~T();
+      ::operator delete(array_new);
+      throw;
     }
-    *size_ptr_ = T{std::forward< Args >(args)...};
-    size_ptr_++;
+    ::operator delete(array_);
+    array_ = array_new;
+    begin_ = array_;
+    capacity_ = capacity_new;
     size_++;
+    size_ptr_ = array_ + size_;
   }
 
   template< typename T >
@@ -252,10 +266,109 @@ namespace alymova
     std::swap(capacity_, other.capacity_);
   }
 
+  template< typename T >
+  T* Array< T >::allocate(size_t capacity)
+  {
+    if (capacity == 0)
+    {
+      return nullptr;
+    }
+    return static_cast< T* >(::operator new(capacity * sizeof(T)));
+  }
+
+  template< typename T >
+  T* Array< T >::next(T* ptr) const noexcept
+  {
+    ptr++;
+    return (ptr == array_ + capacity_) ? array_ : ptr;
+  }
+
+  template< typename T >
+  void Array< T >::copy_to(T* array_new, std::true_type) const noexcept
+  {
+    if (size_ == 0)
+    {
+      return;
+    }
+    size_t head = std::min< size_t >(size_, array_ + capacity_ - begin_);
+    std::memcpy(array_new, begin_, head * sizeof(T));
+    std::memcpy(array_new + head, array_, (size_ - head) * sizeof(T));
+  }
+
+  template< typename T >
+  void Array< T >::copy_to(T* array_new, std::false_type) const
+  {
+    size_t i = 0;
+    try
+    {
+      for (T* ptr = begin_; i < size_; ptr = next(ptr), i++)
+      {
+        new (array_new + i) T(*ptr);
+      }
+    }
+    catch (...)
+    {
+      for (size_t j = 0; j < i; j++)
+      {
+        array_new[j].~T();
+      }
+      throw;
+    }
+  }
+
+  template< typename T >
+  void Array< T >::relocate(T* array_new, std::true_type) noexcept
+  {
+    copy_to(array_new, std::true_type{});
+  }
+
+  template< typename T >
+  void Array< T >::relocate(T* array_new, std::false_type)
+  {
+    size_t i = 0;
+    try
+    {
+      for (T* ptr = begin_; i < size_; ptr = next(ptr), i++)
+      {
+        new (array_new + i) T(std::move_if_noexcept(*ptr));
+      }
+    }
+    catch (...)
+    {
+      for (size_t j = 0; j < i; j++)
+      {
+        array_new[j].~T();
+      }
+      throw;
+    }
+    destroy();
+  }
+
+  template< typename T >
+  void Array< T >::destroy() noexcept
+  {
+    T* ptr = begin_;
+    for (size_t i = 0; i < size_; i++)
+    {
+      ptr->~T();
+      ptr = next(ptr);
+    }
+  }
+
   template< typename T >
   void Array< T >::clear() noexcept
   {
-    delete[] array_;
+    destroy();
+    begin_ = array_;
+    size_ptr_ = array_;
+    size_ = 0;
+  }
+
+  template< typename T >
+  void Array< T >::release() noexcept
+  {
+    destroy();
+    ::operator delete(array_);
   }
 }
 #endif
@@ -0,0 +1,290 @@
+#include "input-buffer.hpp"
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+  bool is_space(char c) noexcept
+  {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+  }
+}
+
+std::string alymova::StringView::str() const
+{
+  return std::string(data, size);
+}
+
+alymova::InputBuffer::InputBuffer(const char* filename):
+  data_(nullptr),
+  size_(0),
+  mapped_(false),
+  open_(false)
+{
+  int fd = ::open(filename, O_RDONLY);
+  if (fd < 0)
+  {
+    return;
+  }
+  open_ = true;
+  struct stat info;
+  bool regular = ::fstat(fd, &info) == 0 && S_ISREG(info.st_mode);
+  if (regular && info.st_size > 0)
+  {
+    void* mapping = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED)
+    {
+      ::madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+      data_ = static_cast< char* >(mapping);
+      size_ = info.st_size;
+      mapped_ = true;
+    }
+  }
+  if (!mapped_)
+  {
+    try
+    {
+      read_all(fd);
+    }
+    catch (...)
+    {
+      ::close(fd);
+      throw;
+    }
+  }
+  ::close(fd);
+}
+
+alymova::InputBuffer::InputBuffer(std::istream& in):
+  data_(nullptr),
+  size_(0),
+  mapped_(false),
+  open_(true)
+{
+  std::ostringstream contents;
+  contents << in.rdbuf();
+  buffer_ = contents.str();
+  data_ = &buffer_[0];
+  size_ = buffer_.size();
+}
+
+alymova::InputBuffer::~InputBuffer() noexcept
+{
+  if (mapped_)
+  {
+    ::munmap(data_, size_);
+  }
+}
+
+bool alymova::InputBuffer::is_open() const noexcept
+{
+  return open_;
+}
+
+const char* alymova::InputBuffer::begin() const noexcept
+{
+  return data_;
+}
+
+const char* alymova::InputBuffer::end() const noexcept
+{
+  return data_ + size_;
+}
+
+void alymova::InputBuffer::read_all(int fd)
+{
+  buffer_.resize(4096);
+  ssize_t count = 0;
+  while ((count = ::read(fd, &buffer_[size_], buffer_.size() - size_)) > 0)
+  {
+    size_ += count;
+    if (size_ == buffer_.size())
+    {
+      buffer_.resize(size_ * 2);
+    }
+  }
+  data_ = &buffer_[0];
+}
+
+alymova::TextReader::TextReader(const char* first, const char* last) noexcept:
+  pos_(first),
+  last_(last),
+  eof_(false),
+  fail_(false)
+{}
+
+alymova::TextReader::operator bool() const noexcept
+{
+  return !fail_;
+}
+
+bool alymova::TextReader::eof() const noexcept
+{
+  return eof_;
+}
+
+bool alymova::TextReader::fail() const noexcept
+{
+  return fail_;
+}
+
+int alymova::TextReader::peek() noexcept
+{
+  if (eof_ || fail_)
+  {
+    fail_ = true;
+    return std::char_traits< char >::eof();
+  }
+  if (pos_ == last_)
+  {
+    eof_ = true;
+    return std::char_traits< char >::eof();
+  }
+  return std::char_traits< char >::to_int_type(*pos_);
+}
+
+bool alymova::TextReader::get_line(StringView& line) noexcept
+{
+  if (pos_ == last_)
+  {
+    eof_ = true;
+    fail_ = true;
+    return false;
+  }
+  const void* found = std::memchr(pos_, '\n', last_ - pos_);
+  const char* line_end = found ? static_cast< const char* >(found) : last_;
+  line = {pos_, static_cast< size_t >(line_end - pos_)};
+  pos_ = line_end;
+  if (pos_ == last_)
+  {
+    eof_ = true;
+  }
+  else
+  {
+    ++pos_;
+  }
+  return true;
+}
+
+alymova::TextReader& alymova::TextReader::operator>>(StringView& word) noexcept
+{
+  if (!skip_spaces())
+  {
+    return *this;
+  }
+  const char* first = pos_;
+  while (pos_ != last_ && !is_space(*pos_))
+  {
+    ++pos_;
+  }
+  eof_ = (pos_ == last_);
+  word = {first, static_cast< size_t >(pos_ - first)};
+  return *this;
+}
+
+alymova::TextReader& alymova::TextReader::operator>>(int& value) noexcept
+{
+  if (!skip_spaces())
+  {
+    return *this;
+  }
+  bool negative = read_sign();
+  unsigned long long max = std::numeric_limits< int >::max();
+  unsigned long long result = 0;
+  bool overflow = false;
+  if (!read_digits(result, max + negative, overflow))
+  {
+    value = 0;
+  }
+  else if (overflow)
+  {
+    fail_ = true;
+  }
+  else
+  {
+    long long signed_result = static_cast< long long >(result);
+    value = static_cast< int >(negative ? -signed_result : signed_result);
+  }
+  return *this;
+}
+
+alymova::TextReader& alymova::TextReader::operator>>(size_t& value) noexcept
+{
+  if (!skip_spaces())
+  {
+    return *this;
+  }
+  bool negative = read_sign();
+  unsigned long long result = 0;
+  bool overflow = false;
+  if (!read_digits(result, std::numeric_limits< size_t >::max(), overflow))
+  {
+    value = 0;
+  }
+  else if (overflow)
+  {
+    fail_ = true;
+  }
+  else
+  {
+    value = negative ? 0 - static_cast< size_t >(result) : static_cast< size_t >(result);
+  }
+  return *this;
+}
+
+bool alymova::TextReader::skip_spaces() noexcept
+{
+  if (eof_ || fail_)
+  {
+    fail_ = true;
+    return false;
+  }
+  while (pos_ != last_ && is_space(*pos_))
+  {
+    ++pos_;
+  }
+  if (pos_ == last_)
+  {
+    eof_ = true;
+    fail_ = true;
+    return false;
+  }
+  return true;
+}
+
+bool alymova::TextReader::read_sign() noexcept
+{
+  bool negative = (*pos_ == '-');
+  if (negative || *pos_ == '+')
+  {
+    ++pos_;
+  }
+  return negative;
+}
+
+bool alymova::TextReader::read_digits(unsigned long long& result, unsigned long long max, bool& overflow) noexcept
+{
+  const char* first = pos_;
+  for (; pos_ != last_ && *pos_ >= '0' && *pos_ <= '9'; ++pos_)
+  {
+    unsigned long long digit = *pos_ - '0';
+    if (overflow || result > max / 10 || result * 10 > max - digit)
+    {
+      overflow = true;
+      continue;
+    }
+    result = result * 10 + digit;
+  }
+  eof_ = (pos_ == last_);
+  if (pos_ == first)
+  {
+    fail_ = true;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,78 @@
+#ifndef INPUT_BUFFER_HPP
+#define INPUT_BUFFER_HPP
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+namespace alymova
+{
+  struct StringView
+  {
+    const char* data;
+    size_t size;
+
+    std::string str() const;
+  };
+
+  inline int compare_strings(const char* lhs, size_t lhs_size, const char* rhs, size_t rhs_size) noexcept
+  {
+    int result = std::char_traits< char >::compare(lhs, rhs, lhs_size < rhs_size ? lhs_size : rhs_size);
+    return result != 0 ? result : (lhs_size < rhs_size ? -1 : (rhs_size < lhs_size ? 1 : 0));
+  }
+
+  inline bool operator<(const std::string& lhs, StringView rhs) noexcept
+  {
+    return compare_strings(lhs.data(), lhs.size(), rhs.data, rhs.size) < 0;
+  }
+
+  inline bool operator<(StringView lhs, const std::string& rhs) noexcept
+  {
+    return compare_strings(lhs.data, lhs.size, rhs.data(), rhs.size()) < 0;
+  }
+
+  struct InputBuffer
+  {
+    explicit InputBuffer(const char* filename);
+    explicit InputBuffer(std::istream& in);
+    InputBuffer(const InputBuffer& other) = delete;
+    ~InputBuffer() noexcept;
+
+    InputBuffer& operator=(const InputBuffer& other) = delete;
+
+    bool is_open() const noexcept;
+    const char* begin() const noexcept;
+    const char* end() const noexcept;
+  private:
+    char* data_;
+    size_t size_;
+    bool mapped_;
+    bool open_;
+    std::string buffer_;
+
+    void read_all(int fd);
+  };
+
+  struct TextReader
+  {
+    TextReader(const char* first, const char* last) noexcept;
+
+    explicit operator bool() const noexcept;
+    bool eof() const noexcept;
+    bool fail() const noexcept;
+    int peek() noexcept;
+    bool get_line(StringView& line) noexcept;
+    TextReader& operator>>(StringView& word) noexcept;
+    TextReader& operator>>(int& value) noexcept;
+    TextReader& operator>>(size_t& value) noexcept;
+  private:
+    const char* pos_;
+    const char* last_;
+    bool eof_;
+    bool fail_;
+
+    bool skip_spaces() noexcept;
+    bool read_sign() noexcept;
+    bool read_digits(unsigned long long& result, unsigned long long max, bool& overflow) noexcept;
+  };
+}
+#endif
@@ -18,8 +18,8 @@ namespace alymova
     Iterator< T > operator--(int) noexcept;
     bool operator==(const Iterator< T >& other) const noexcept;
     bool operator!=(const Iterator< T >& other) const noexcept;
-    T& operator*() noexcept;
-    T* operator->() noexcept;
+    T& operator*() const noexcept;
+    T* operator->() const noexcept;
   private:
     friend class List< T >;
     detail::ListNode< T >* node_;
@@ -37,8 +37,8 @@ namespace alymova
     ConstIterator< T > operator--(int) noexcept;
     bool operator==(const ConstIterator< T >& other) const noexcept;
     bool operator!=(const ConstIterator< T >& other) const noexcept;
-    const T& operator*() noexcept;
-    const T* operator->() noexcept;
+    const T& operator*() const noexcept;
+    const T* operator->() const noexcept;
   private:
     friend class List< T >;
     const detail::ListNode< T >* node_;
@@ -102,14 +102,14 @@ namespace alymova
   }
 
   template< typename T >
-  T& Iterator< T >::operator*() noexcept
+  T& Iterator< T >::operator*() const noexcept
   {
     assert(node_ != nullptr && "You are trying to access beyond list's bounds");
     return node_->data;
   }
 
   template< typename T >
-  T* Iterator< T >::operator->() noexcept
+  T* Iterator< T >::operator->() const noexcept
   {
     assert(node_ != nullptr && "You are trying to access beyond list's bounds");
     return std::addressof(node_->data);
@@ -172,14 +172,14 @@ namespace alymova
   }
 
   template< typename T >
-  const T& ConstIterator< T >::operator*() noexcept
+  const T& ConstIterator< T >::operator*() const noexcept
   {
     assert(node_ != nullptr && "You are trying to access beyond list's bounds");
     return node_->data;
   }
 
   template< typename T >
-  const T* ConstIterator< T >::operator->() noexcept
+  const T* ConstIterator< T >::operator->() const noexcept
   {
     assert(node_ != nullptr && "You are trying to access beyond list's bounds");
     return std::addressof(node_->data);
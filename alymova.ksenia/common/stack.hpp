@@ -15,6 +15,7 @@ namespace alymova
     void push(const T& value);
     void push(T&& value);
     void pop() noexcept;
+    void clear() noexcept;
 
   private:
     Array< T > data_;
@@ -61,5 +62,11 @@ namespace alymova
   {
     data_.pop_back();
   }
+
+  template< typename T >
+  void Stack< T >::clear() noexcept
+  {
+    data_.clear();
+  }
 }
 #endif
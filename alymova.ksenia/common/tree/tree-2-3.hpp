@@ -3,7 +3,10 @@
 #include <cstddef>
 #include <cassert>
 #include <functional>
+#include <initializer_list>
 #include <exception>
+#include <iterator>
+#include <utility>
 #include "tree-iterators.hpp"
 #include "tree-iterator-impl.hpp"
 #include "tree-const-iterator-impl.hpp"
@@ -44,21 +47,25 @@ namespace alymova
     Value& operator[](const Key& key);
     Value& at(const Key& key);
     const Value& at(const Key& key) const;
+    template< class K, class C = Comparator, class = typename C::is_transparent >
+    Value& at(const K& key);
+    template< class K, class C = Comparator, class = typename C::is_transparent >
+    const Value& at(const K& key) const;
 
     template< class F >
-    F traverse_lnr(F f);
+    F traverse_lnr(F&& f);
     template< class F >
-    F traverse_lnr(F f) const;
+    F traverse_lnr(F&& f) const;
 
     template< class F >
-    F traverse_rnl(F f);
+    F traverse_rnl(F&& f);
     template< class F >
-    F traverse_rnl(F f) const;
+    F traverse_rnl(F&& f) const;
 
     template< class F >
-    F traverse_breadth(F f);
+    F traverse_breadth(F&& f);
     template< class F >
-    F traverse_breadth(F f) const;
+    F traverse_breadth(F&& f) const;
 
     Iterator begin() noexcept;
     ConstIterator begin() const noexcept;
@@ -98,8 +105,14 @@ namespace alymova
     void clear() noexcept;
 
     size_t count(const Key& key) const;
+    template< class K, class C = Comparator, class = typename C::is_transparent >
+    size_t count(const K& key) const;
     Iterator find(const Key& key);
     ConstIterator find(const Key& key) const;
+    template< class K, class C = Comparator, class = typename C::is_transparent >
+    Iterator find(const K& key);
+    template< class K, class C = Comparator, class = typename C::is_transparent >
+    ConstIterator find(const K& key) const;
     std::pair< Iterator, Iterator > equal_range(const Key& key);
     std::pair< ConstIterator, ConstIterator > equal_range(const Key& key) const;
     Iterator lower_bound(const Key& key);
@@ -107,6 +120,12 @@ namespace alymova
     Iterator upper_bound(const Key& key);
     ConstIterator upper_bound(const Key& key) const;
 
+    Iterator nth(size_t pos);
+    ConstIterator nth(size_t pos) const;
+    size_t rank(const Key& key) const;
+    size_t distance(Iterator first, Iterator last) const noexcept;
+    size_t distance(ConstIterator first, ConstIterator last) const noexcept;
+
   private:
     size_t size_;
     Node* fake_right_;
@@ -115,8 +134,16 @@ namespace alymova
     Comparator cmp_;
 
     void clear(Node* node) noexcept;
+    template< class InputIterator >
+    void assign_range(InputIterator first, InputIterator last, std::input_iterator_tag);
+    template< class ForwardIterator >
+    void assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+    template< class InputIterator >
+    Node* build_sorted(InputIterator& it, size_t count, size_t capacity, Node* parent);
     void move_fake() const noexcept;
     void split_insert(Node* node);
+    template< class K >
+    ConstIterator find_key(const K& key) const;
     Node* find_to_insert(const Key& key) const;
     Node* find_to_insert(ConstIterator hint) const noexcept;
     bool check_hint(ConstIterator hint, const Key& key) const;
@@ -125,6 +152,10 @@ namespace alymova
     void fix(Node* node);
     void distribute_erase(Node* node);
     Node* merge_erase(Node* node);
+    size_t subtree_size(const Node* node) const noexcept;
+    void update_size(Node* node) noexcept;
+    void update_sizes_from(Node* node) noexcept;
+    size_t position(ConstIterator it) const noexcept;
 
     bool is_balanced() const noexcept;
     size_t find_height(Node* node) const noexcept;
@@ -194,10 +225,7 @@ namespace alymova
   TwoThreeTree< Key, Value, Comparator >::TwoThreeTree(InputIterator first, InputIterator last):
     Tree()
   {
-    for (auto it = first; it != last; it++)
-    {
-      emplace(*it);
-    }
+    assign_range(first, last, typename std::iterator_traits< InputIterator >::iterator_category());
   }
 
   template< class Key, class Value, class Comparator >
@@ -262,6 +290,25 @@ namespace alymova
     return (it->second);
   }
 
+  template< class Key, class Value, class Comparator >
+  template< class K, class C, class >
+  Value& TwoThreeTree< Key, Value, Comparator >::at(const K& key)
+  {
+    return const_cast< Value& >(static_cast< const Tree& >(*this).at(key));
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class K, class C, class >
+  const Value& TwoThreeTree< Key, Value, Comparator >::at(const K& key) const
+  {
+    auto it = find_key(key);
+    if (it == end())
+    {
+      throw std::out_of_range("Container does not have an element with the such key");
+    }
+    return (it->second);
+  }
+
   template< class Key, class Value, class Comparator >
   TTTIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::begin() noexcept
   {
@@ -360,56 +407,84 @@ namespace alymova
 
   template< class Key, class Value, class Comparator >
   template< class F >
-  F TwoThreeTree< Key, Value, Comparator >::traverse_lnr(F f)
+  F TwoThreeTree< Key, Value, Comparator >::traverse_lnr(F&& f)
   {
-    return static_cast< const TwoThreeTree& >(*this).traverse_lnr(f);
+    return static_cast< const TwoThreeTree& >(*this).traverse_lnr(std::forward< F >(f));
   }
 
   template< class Key, class Value, class Comparator >
   template< class F >
-  F TwoThreeTree< Key, Value, Comparator >::traverse_lnr(F f) const
+  F TwoThreeTree< Key, Value, Comparator >::traverse_lnr(F&& f) const
   {
     for (auto it = lnr_cbegin(); it != lnr_cend(); ++it)
     {
       f(*it);
     }
-    return f;
+    return std::forward< F >(f);
   }
 
   template< class Key, class Value, class Comparator >
   template< class F >
-  F TwoThreeTree< Key, Value, Comparator >::traverse_rnl(F f)
+  F TwoThreeTree< Key, Value, Comparator >::traverse_rnl(F&& f)
   {
-    return static_cast< const TwoThreeTree& >(*this).traverse_rnl(f);
+    return static_cast< const TwoThreeTree& >(*this).traverse_rnl(std::forward< F >(f));
   }
 
   template< class Key, class Value, class Comparator >
   template< class F >
-  F TwoThreeTree< Key, Value, Comparator >::traverse_rnl(F f) const
+  F TwoThreeTree< Key, Value, Comparator >::traverse_rnl(F&& f) const
   {
     for (auto it = rnl_cbegin(); it != rnl_cend(); ++it)
     {
       f(*it);
     }
-    return f;
+    return std::forward< F >(f);
   }
 
   template< class Key, class Value, class Comparator >
   template< class F >
-  F TwoThreeTree< Key, Value, Comparator >::traverse_breadth(F f)
+  F TwoThreeTree< Key, Value, Comparator >::traverse_breadth(F&& f)
   {
-    return static_cast< const TwoThreeTree& >(*this).traverse_breadth(f);
+    return static_cast< const TwoThreeTree& >(*this).traverse_breadth(std::forward< F >(f));
   }
 
   template< class Key, class Value, class Comparator >
   template< class F >
-  F TwoThreeTree< Key, Value, Comparator >::traverse_breadth(F f) const
+  F TwoThreeTree< Key, Value, Comparator >::traverse_breadth(F&& f) const
   {
-    for (auto it = breadth_cbegin(); it != breadth_cend(); ++it)
+    if (empty())
     {
-      f(*it);
+      return std::forward< F >(f);
+    }
+    const Node** queue = new const Node*[size_];
+    size_t head = 0, tail = 0;
+    queue[tail++] = root_;
+    try
+    {
+      while (head != tail)
+      {
+        const Node* node = queue[head++];
+        f(node->data[0]);
+        if (node->type == NodeType::Triple)
+        {
+          f(node->data[1]);
+        }
+        for (const Node* child: {node->left, node->mid, node->right})
+        {
+          if (child && child->type != NodeType::Fake)
+          {
+            queue[tail++] = child;
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      delete[] queue;
+      throw;
     }
-    return f;
+    delete[] queue;
+    return std::forward< F >(f);
   }
 
   template< class Key, class Value, class Comparator >
@@ -491,19 +566,23 @@ namespace alymova
     TwoThreeTree< Key, Value, Comparator >::emplace_hint(ConstIterator hint, Args&&... args)
   {
     std::pair< Key, Value > value(std::forward< Args >(args)...);
-    Iterator it_value = find(value.first);
-    if (it_value != end())
+    Node* to_insert = nullptr;
+    if (check_hint(hint, value.first))
     {
-      return it_value;
+      to_insert = find_to_insert(hint);
     }
-    Node* to_insert = find_to_insert(hint);
-    if (!check_hint(hint, value.first))
+    else
     {
+      Iterator it_value = find(value.first);
+      if (it_value != end())
+      {
+        return it_value;
+      }
       to_insert = find_to_insert(value.first);
     }
     if (size_ == 0)
     {
-      root_ = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr};
+      root_ = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr, 0};
       to_insert = root_;
     }
     try
@@ -560,6 +639,10 @@ namespace alymova
     {
       fix(pos_instead.node_);
     }
+    else
+    {
+      update_sizes_from(pos_instead.node_);
+    }
     move_fake();
     size_--;
     return (point_next == NodePoint::Fake) ? end() : find(key_next);
@@ -594,7 +677,9 @@ namespace alymova
   void TwoThreeTree< Key, Value, Comparator >::clear() noexcept
   {
     clear(root_);
+    root_ = fake_right_;
     size_ = 0;
+    move_fake();
   }
 
   template< class Key, class Value, class Comparator >
@@ -617,14 +702,32 @@ namespace alymova
   template< class Key, class Value, class Comparator >
   TTTConstIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::find(const Key& key) const
   {
-    for (ConstIterator it = cbegin(); it != cend(); it++)
+    return find_key(key);
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class K, class C, class >
+  size_t TwoThreeTree< Key, Value, Comparator >::count(const K& key) const
+  {
+    if (find_key(key) != cend())
     {
-      if (!cmp_(key, it->first) && !cmp_(it->first, key))
-      {
-        return it;
-      }
+      return 1;
     }
-    return cend();
+    return 0;
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class K, class C, class >
+  TTTIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::find(const K& key)
+  {
+    return Iterator(find_key(key));
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class K, class C, class >
+  TTTConstIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::find(const K& key) const
+  {
+    return find_key(key);
   }
 
   template< class Key, class Value, class Comparator >
@@ -653,14 +756,26 @@ namespace alymova
   TTTConstIterator< Key, Value, Comparator >
     TwoThreeTree< Key, Value, Comparator >::lower_bound(const Key& key) const
   {
-    for (auto it = cbegin(); it != cend(); it++)
+    ConstIterator result = cend();
+    Node* tmp = root_;
+    while (tmp && tmp->type != NodeType::Fake && tmp->type != NodeType::Empty)
     {
-      if (!cmp_(it->first, key))
+      if (!cmp_(tmp->data[0].first, key))
+      {
+        result = ConstIterator(tmp, NodePoint::First);
+        tmp = tmp->left;
+      }
+      else if (tmp->type == NodeType::Triple && !cmp_(tmp->data[1].first, key))
       {
-        return it;
+        result = ConstIterator(tmp, NodePoint::Second);
+        tmp = tmp->mid;
+      }
+      else
+      {
+        tmp = tmp->right;
       }
     }
-    return cend();
+    return result;
   }
 
   template< class Key, class Value, class Comparator >
@@ -675,14 +790,111 @@ namespace alymova
   TTTConstIterator< Key, Value, Comparator >
     TwoThreeTree< Key, Value, Comparator >::upper_bound(const Key& key) const
   {
-    for (auto it = cbegin(); it != cend(); it++)
+    ConstIterator result = cend();
+    Node* tmp = root_;
+    while (tmp && tmp->type != NodeType::Fake && tmp->type != NodeType::Empty)
     {
-      if (cmp_(key, it->first))
+      if (cmp_(key, tmp->data[0].first))
       {
-        return it;
+        result = ConstIterator(tmp, NodePoint::First);
+        tmp = tmp->left;
+      }
+      else if (tmp->type == NodeType::Triple && cmp_(key, tmp->data[1].first))
+      {
+        result = ConstIterator(tmp, NodePoint::Second);
+        tmp = tmp->mid;
+      }
+      else
+      {
+        tmp = tmp->right;
       }
     }
-    return cend();
+    return result;
+  }
+
+  template< class Key, class Value, class Comparator >
+  TTTIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::nth(size_t pos)
+  {
+    ConstIterator tmp = static_cast< const Tree& >(*this).nth(pos);
+    return Iterator(tmp);
+  }
+
+  template< class Key, class Value, class Comparator >
+  TTTConstIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::nth(size_t pos) const
+  {
+    if (pos >= size_)
+    {
+      return cend();
+    }
+    Node* tmp = root_;
+    while (true)
+    {
+      size_t left_size = subtree_size(tmp->left);
+      if (pos < left_size)
+      {
+        tmp = tmp->left;
+        continue;
+      }
+      pos -= left_size;
+      if (pos == 0)
+      {
+        return ConstIterator(tmp, NodePoint::First);
+      }
+      pos--;
+      if (tmp->type == NodeType::Triple)
+      {
+        size_t mid_size = subtree_size(tmp->mid);
+        if (pos < mid_size)
+        {
+          tmp = tmp->mid;
+          continue;
+        }
+        pos -= mid_size;
+        if (pos == 0)
+        {
+          return ConstIterator(tmp, NodePoint::Second);
+        }
+        pos--;
+      }
+      tmp = tmp->right;
+    }
+  }
+
+  template< class Key, class Value, class Comparator >
+  size_t TwoThreeTree< Key, Value, Comparator >::rank(const Key& key) const
+  {
+    size_t result = 0;
+    const Node* tmp = root_;
+    while (tmp && tmp->type != NodeType::Fake)
+    {
+      if (!cmp_(tmp->data[0].first, key))
+      {
+        tmp = tmp->left;
+      }
+      else if (tmp->type == NodeType::Triple && !cmp_(tmp->data[1].first, key))
+      {
+        result += subtree_size(tmp->left) + 1;
+        tmp = tmp->mid;
+      }
+      else
+      {
+        result += tmp->subtree_size - subtree_size(tmp->right);
+        tmp = tmp->right;
+      }
+    }
+    return result;
+  }
+
+  template< class Key, class Value, class Comparator >
+  size_t TwoThreeTree< Key, Value, Comparator >::distance(Iterator first, Iterator last) const noexcept
+  {
+    return distance(ConstIterator(first), ConstIterator(last));
+  }
+
+  template< class Key, class Value, class Comparator >
+  size_t TwoThreeTree< Key, Value, Comparator >::distance(ConstIterator first, ConstIterator last) const noexcept
+  {
+    return position(last) - position(first);
   }
 
   template< class Key, class Value, class Comparator >
@@ -698,11 +910,99 @@ namespace alymova
     delete root;
   }
 
+  template< class Key, class Value, class Comparator >
+  template< class InputIterator >
+  void TwoThreeTree< Key, Value, Comparator >::assign_range(InputIterator first, InputIterator last,
+    std::input_iterator_tag)
+  {
+    for (auto it = first; it != last; it++)
+    {
+      emplace(*it);
+    }
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class ForwardIterator >
+  void TwoThreeTree< Key, Value, Comparator >::assign_range(ForwardIterator first, ForwardIterator last,
+    std::forward_iterator_tag)
+  {
+    if (first == last)
+    {
+      return;
+    }
+    size_t count = 1;
+    for (auto prev = first, it = std::next(first); it != last; ++prev, ++it, ++count)
+    {
+      if (!cmp_(prev->first, it->first))
+      {
+        assign_range(first, last, std::input_iterator_tag());
+        return;
+      }
+    }
+    size_t capacity = 2;
+    while (capacity < count)
+    {
+      capacity = capacity * 3 + 2;
+    }
+    root_ = build_sorted(first, count, capacity, nullptr);
+    size_ = count;
+    move_fake();
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class InputIterator >
+  detail::TTTNode< Key, Value, Comparator >* TwoThreeTree< Key, Value, Comparator >::build_sorted(
+    InputIterator& it, size_t count, size_t capacity, Node* parent)
+  {
+    assert(count > 0 && count <= capacity && "Incorrect subtree size");
+    Node* node = new Node{{}, NodeType::Empty, parent, nullptr, nullptr, nullptr, nullptr, count};
+    try
+    {
+      if (capacity == 2)
+      {
+        for (size_t i = 0; i < count; ++i, ++it)
+        {
+          node->data[i] = *it;
+        }
+        node->type = (count == 1) ? NodeType::Double : NodeType::Triple;
+        return node;
+      }
+      size_t child_capacity = (capacity - 2) / 3;
+      if (count - 1 <= 2 * child_capacity)
+      {
+        size_t left_count = (count - 1) / 2;
+        node->left = build_sorted(it, left_count, child_capacity, node);
+        node->data[0] = *it;
+        ++it;
+        node->right = build_sorted(it, count - 1 - left_count, child_capacity, node);
+        node->type = NodeType::Double;
+        return node;
+      }
+      size_t left_count = (count - 2) / 3;
+      size_t mid_count = (count - 2 - left_count) / 2;
+      node->left = build_sorted(it, left_count, child_capacity, node);
+      node->data[0] = *it;
+      ++it;
+      node->mid = build_sorted(it, mid_count, child_capacity, node);
+      node->data[1] = *it;
+      ++it;
+      node->right = build_sorted(it, count - 2 - left_count - mid_count, child_capacity, node);
+      node->type = NodeType::Triple;
+      return node;
+    }
+    catch (...)
+    {
+      clear(node);
+      throw;
+    }
+  }
+
   template< class Key, class Value, class Comparator >
   void TwoThreeTree< Key, Value, Comparator >::split_insert(Node* node)
   {
     if (node->type != NodeType::Overflow)
     {
+      update_sizes_from(node);
       return;
     }
     Node* left = nullptr, *right = nullptr, *parent = nullptr;
@@ -711,11 +1011,11 @@ namespace alymova
       parent = node->parent;
       if (!parent)
       {
-        parent = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr};
+        parent = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr, 0};
         root_ = parent;
       }
-      left = new Node{{node->data[0]}, NodeType::Double, parent, node->left, nullptr, node->mid, nullptr};
-      right = new Node{{node->data[2]}, NodeType::Double, parent, node->right, nullptr, node->overflow, nullptr};
+      left = new Node{{node->data[0]}, NodeType::Double, parent, node->left, nullptr, node->mid, nullptr, 0};
+      right = new Node{{node->data[2]}, NodeType::Double, parent, node->right, nullptr, node->overflow, nullptr, 0};
       if (left->left && left->left != fake_left_)
       {
         left->left->parent = left;
@@ -727,6 +1027,8 @@ namespace alymova
       {
         right->left = nullptr;
       }
+      update_size(left);
+      update_size(right);
       parent->insert(node->data[1]);
       {
         if (parent->type == NodeType::Double)
@@ -800,6 +1102,37 @@ namespace alymova
     fake_left_->parent = tmp;
   }
 
+  template< class Key, class Value, class Comparator >
+  template< class K >
+  TTTConstIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::find_key(const K& key) const
+  {
+    Node* tmp = root_;
+    while (tmp && tmp->type != NodeType::Fake && tmp->type != NodeType::Empty)
+    {
+      if (cmp_(key, tmp->data[0].first))
+      {
+        tmp = tmp->left;
+      }
+      else if (!cmp_(tmp->data[0].first, key))
+      {
+        return ConstIterator(tmp, NodePoint::First);
+      }
+      else if (tmp->type == NodeType::Triple && cmp_(key, tmp->data[1].first))
+      {
+        tmp = tmp->mid;
+      }
+      else if (tmp->type == NodeType::Triple && !cmp_(tmp->data[1].first, key))
+      {
+        return ConstIterator(tmp, NodePoint::Second);
+      }
+      else
+      {
+        tmp = tmp->right;
+      }
+    }
+    return cend();
+  }
+
   template< class Key, class Value, class Comparator >
   detail::TTTNode< Key, Value, Comparator >*
     TwoThreeTree< Key, Value, Comparator >::find_to_insert(const Key& key) const
@@ -920,11 +1253,13 @@ namespace alymova
     }
     if (!node->parent)
     {
+      update_sizes_from(node);
       return;
     }
     if (have_triple_neighbor(node))
     {
       distribute_erase(node);
+      update_sizes_from(node->parent);
       return;
     }
     Node* new_node = merge_erase(node);
@@ -1123,6 +1458,7 @@ namespace alymova
     }
     node_merge->insert(std::move(parent->data[0]));
     parent->remove(NodePoint::First);
+    update_size(node_merge);
     node->clear();
     delete node;
 
@@ -1137,6 +1473,67 @@ namespace alymova
     return parent;
   }
 
+  template< class Key, class Value, class Comparator >
+  size_t TwoThreeTree< Key, Value, Comparator >::subtree_size(const Node* node) const noexcept
+  {
+    if (!node || node->type == NodeType::Fake)
+    {
+      return 0;
+    }
+    return node->subtree_size;
+  }
+
+  template< class Key, class Value, class Comparator >
+  void TwoThreeTree< Key, Value, Comparator >::update_size(Node* node) noexcept
+  {
+    node->subtree_size = static_cast< size_t >(node->type) + subtree_size(node->left) + subtree_size(node->mid) +
+      subtree_size(node->right) + subtree_size(node->overflow);
+  }
+
+  template< class Key, class Value, class Comparator >
+  void TwoThreeTree< Key, Value, Comparator >::update_sizes_from(Node* node) noexcept
+  {
+    Node* children[] = {node->left, node->mid, node->right};
+    for (Node* child: children)
+    {
+      if (child && child->type != NodeType::Fake)
+      {
+        update_size(child);
+      }
+    }
+    for (; node; node = node->parent)
+    {
+      update_size(node);
+    }
+  }
+
+  template< class Key, class Value, class Comparator >
+  size_t TwoThreeTree< Key, Value, Comparator >::position(ConstIterator it) const noexcept
+  {
+    if (it.point_ == NodePoint::Fake)
+    {
+      return size_;
+    }
+    const Node* node = it.node_;
+    size_t result = subtree_size(node->left) + 1;
+    if (it.point_ == NodePoint::Second)
+    {
+      result += subtree_size(node->mid) + 1;
+    }
+    for (; node->parent; node = node->parent)
+    {
+      if (node == node->parent->right)
+      {
+        result += node->parent->subtree_size - node->subtree_size;
+      }
+      else if (node == node->parent->mid)
+      {
+        result += subtree_size(node->parent->left) + 1;
+      }
+    }
+    return result - 1;
+  }
+
   template< class Key, class Value, class Comparator >
   bool TwoThreeTree< Key, Value, Comparator >::is_balanced() const noexcept
   {
@@ -1,11 +1,10 @@
 #ifndef TREE_BREADTH_ITERATOR_HPP
 #define TREE_BREADTH_ITERATOR_HPP
+#include <cassert>
+#include <cstddef>
 #include <iterator>
-#include <queue.hpp>
 #include "tree-node.hpp"
 
-#include <iostream>
-
 namespace alymova
 {
   template< class Key, class Value, class Comparator >
@@ -27,9 +26,9 @@ namespace alymova
     const std::pair< Key, Value >* operator->() const noexcept;
   protected:
     std::pair< Node*, NodePoint > node_;
-    Queue< std::pair< Node*, NodePoint > > nexts_;
 
     TTTConstBreadthIterator(Node* node, NodePoint point);
+    static Node* next_sibling(Node* node) noexcept;
 
     friend class TwoThreeTree< Key, Value, Comparator >;
   };
@@ -50,24 +49,28 @@ namespace alymova
 
   template < class Key, class Value, class Comparator >
   TTTConstBreadthIterator< Key, Value, Comparator >::TTTConstBreadthIterator():
-    node_({nullptr, NodeType::Empty}),
-    nexts_()
+    node_({nullptr, NodeType::Empty})
   {}
 
   template< class Key, class Value, class Comparator >
   TTTConstBreadthIterator< Key, Value, Comparator >::TTTConstBreadthIterator(Node* node, NodePoint point):
-    node_({node, point}),
-    nexts_()
+    node_({node, point})
+  {}
+
+  template< class Key, class Value, class Comparator >
+  typename TTTConstBreadthIterator< Key, Value, Comparator >::Node*
+    TTTConstBreadthIterator< Key, Value, Comparator >::next_sibling(Node* node) noexcept
   {
-    if (point != NodePoint::Fake && node)
+    Node* parent = node->parent;
+    if (node == parent->left)
     {
-      nexts_.push(node_);
-      if (node_.first->type == NodeType::Triple)
-      {
-        nexts_.push({node_.first, NodePoint::Second});
-      }
-      ++(*this);
+      return (parent->mid) ? parent->mid : parent->right;
+    }
+    if (node == parent->mid)
+    {
+      return parent->right;
     }
+    return nullptr;
   }
 
   template< class Key, class Value, class Comparator >
@@ -76,51 +79,38 @@ namespace alymova
     assert(node_.first != nullptr && "You are trying to access beyond tree's bounds");
     assert(node_.second != NodePoint::Fake && "You are trying to access beyond tree's bounds");
 
-    node_ = nexts_.front();
-    nexts_.pop();
-    if (node_.second == NodePoint::Second)
+    Node* node = node_.first;
+    if (node_.second == NodePoint::First && node->type == NodeType::Triple)
     {
+      node_.second = NodePoint::Second;
       return (*this);
     }
-    Node* node = node_.first;
-    if (node->left)
+    // all leaves of a 2-3 tree share one depth, so the next node of a level is
+    // reached by climbing to the nearest sibling and descending leftmost back down
+    size_t depth = 0;
+    while (node->parent && !next_sibling(node))
     {
-      if (node->left->type == NodeType::Fake)
-      {
-        nexts_.push({node->left, NodePoint::Fake});
-      }
-      else
-      {
-        nexts_.push({node->left, NodePoint::First});
-        if (node->left->type == NodeType::Triple)
-        {
-          nexts_.push({node->left, NodePoint::Second});
-        }
-      }
+      node = node->parent;
+      depth++;
     }
-    if (node->mid)
+    if (node->parent)
     {
-      nexts_.push({node->mid, NodePoint::First});
-      if (node->mid->type == NodeType::Triple)
-      {
-        nexts_.push({node->mid, NodePoint::Second});
-      }
+      node = next_sibling(node);
     }
-    if (node->right)
+    else
     {
-      if (node->right->type == NodeType::Fake)
-      {
-        nexts_.push({node->right, NodePoint::Fake});
-      }
-      else
+      depth++;
+    }
+    for (; depth > 0; depth--)
+    {
+      if (!node->left || node->left->type == NodeType::Fake)
       {
-        nexts_.push({node->right, NodePoint::First});
-        if (node->right->type == NodeType::Triple)
-        {
-          nexts_.push({node->right, NodePoint::Second});
-        }
+        node_ = {node, NodePoint::Fake};
+        return (*this);
       }
+      node = node->left;
     }
+    node_ = {node, NodePoint::First};
     return (*this);
   }
 
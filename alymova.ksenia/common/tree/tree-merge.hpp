@@ -0,0 +1,102 @@
+#ifndef TREE_MERGE_HPP
+#define TREE_MERGE_HPP
+
+namespace alymova
+{
+  template< class InputIt1, class InputIt2, class Comparator, class F >
+  F merge_union(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Comparator cmp, F f);
+
+  template< class InputIt1, class InputIt2, class Comparator, class F >
+  F merge_intersection(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Comparator cmp, F f);
+
+  template< class InputIt1, class InputIt2, class Comparator, class F >
+  F merge_symmetric_difference(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+    Comparator cmp, F f);
+
+  template< class InputIt1, class InputIt2, class Comparator, class F >
+  F merge_union(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Comparator cmp, F f)
+  {
+    while (first1 != last1 && first2 != last2)
+    {
+      if (cmp(first2->first, first1->first))
+      {
+        f(*first2);
+        ++first2;
+        continue;
+      }
+      if (!cmp(first1->first, first2->first))
+      {
+        ++first2;
+      }
+      f(*first1);
+      ++first1;
+    }
+    for (; first1 != last1; ++first1)
+    {
+      f(*first1);
+    }
+    for (; first2 != last2; ++first2)
+    {
+      f(*first2);
+    }
+    return f;
+  }
+
+  template< class InputIt1, class InputIt2, class Comparator, class F >
+  F merge_intersection(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Comparator cmp, F f)
+  {
+    while (first1 != last1 && first2 != last2)
+    {
+      if (cmp(first1->first, first2->first))
+      {
+        ++first1;
+      }
+      else if (cmp(first2->first, first1->first))
+      {
+        ++first2;
+      }
+      else
+      {
+        f(*first1);
+        ++first1;
+        ++first2;
+      }
+    }
+    return f;
+  }
+
+  template< class InputIt1, class InputIt2, class Comparator, class F >
+  F merge_symmetric_difference(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+    Comparator cmp, F f)
+  {
+    while (first1 != last1 && first2 != last2)
+    {
+      if (cmp(first1->first, first2->first))
+      {
+        f(*first1);
+        ++first1;
+      }
+      else if (cmp(first2->first, first1->first))
+      {
+        f(*first2);
+        ++first2;
+      }
+      else
+      {
+        ++first1;
+        ++first2;
+      }
+    }
+    for (; first1 != last1; ++first1)
+    {
+      f(*first1);
+    }
+    for (; first2 != last2; ++first2)
+    {
+      f(*first2);
+    }
+    return f;
+  }
+}
+
+#endif
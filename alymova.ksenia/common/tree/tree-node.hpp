@@ -1,5 +1,6 @@
 #ifndef TREE_NODE_HPP
 #define TREE_NODE_HPP
+#include <cstddef>
 #include <utility>
 #include "tree-iterators.hpp"
 
@@ -21,6 +22,7 @@ namespace alymova
       Node* mid;
       Node* right;
       Node* overflow;
+      size_t subtree_size;
 
       void insert(const std::pair< Key, Value >& value);
       void remove(NodePoint point) noexcept;
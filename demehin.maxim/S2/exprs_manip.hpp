@@ -6,7 +6,7 @@
 
 namespace demehin
 {
-  using ExprQueue = demehin::Queue< std::string >;
+  using ExprQueue = demehin::Queue< std::string, ChunkedArray< std::string > >;
   using ExprsStack = demehin::Stack< ExprQueue >;
   void convertStack(ExprsStack& infExprs, ExprsStack& postExprs);
   ExprQueue convertQueue(ExprQueue& infExpr);
@@ -7,7 +7,7 @@
 
 namespace
 {
-  using ExprsStack = demehin::Stack< demehin::Queue < std::string > >;
+  using ExprsStack = demehin::ExprsStack;
 
   void inputExprs(std::istream& in, ExprsStack& stack)
   {
@@ -19,7 +19,7 @@ namespace
         continue;
       }
 
-      demehin::Queue< std::string > exprQueue;
+      demehin::ExprQueue exprQueue;
       size_t token_begin = 0;
       size_t token_end = line.find(' ');
 
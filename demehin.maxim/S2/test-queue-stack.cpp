@@ -64,3 +64,123 @@ BOOST_AUTO_TEST_CASE(queue_test)
   BOOST_TEST(mv_queue.front() == 2);
   BOOST_TEST(mv_queue.back() == 4);
 }
+
+BOOST_AUTO_TEST_CASE(chunked_backend_test)
+{
+  demehin::Queue< std::string, demehin::ChunkedArray< std::string > > queue;
+  demehin::Stack< size_t, demehin::ChunkedArray< size_t > > stack;
+  const size_t count = 5000;
+  for (size_t i = 0; i < count; i++)
+  {
+    queue.push(std::to_string(i));
+    stack.push(i);
+    if (i % 3 == 2)
+    {
+      queue.pop();
+      stack.pop();
+    }
+  }
+  const std::string* first = &queue.front();
+  const size_t* top = &stack.top();
+  BOOST_TEST(*top == count - 1);
+  for (size_t i = count; i < 2 * count; i++)
+  {
+    queue.push(std::to_string(i));
+    stack.push(i);
+  }
+  BOOST_TEST(first == &queue.front());
+  for (size_t i = count; i < 2 * count; i++)
+  {
+    stack.pop();
+  }
+  BOOST_TEST(top == &stack.top());
+
+  auto cpy_queue(queue);
+  BOOST_TEST(cpy_queue.size() == queue.size());
+  for (size_t i = count / 3; i < 2 * count; i++)
+  {
+    BOOST_TEST(queue.front() == std::to_string(i));
+    BOOST_TEST(cpy_queue.back() == queue.back());
+    queue.pop();
+  }
+  BOOST_TEST(queue.empty());
+  BOOST_TEST(cpy_queue.front() == std::to_string(count / 3));
+
+  while (!stack.empty())
+  {
+    stack.pop();
+  }
+  BOOST_CHECK_THROW(stack.top(), std::logic_error);
+  stack.push(1);
+  BOOST_TEST(stack.top() == 1);
+}
+
+namespace
+{
+  struct Counted
+  {
+    static size_t created;
+    static size_t copiesLeft;
+    int value;
+
+    Counted():
+      value(0)
+    {
+      created++;
+    }
+
+    Counted(int val):
+      value(val)
+    {
+      created++;
+    }
+
+    Counted(const Counted& other):
+      value(other.value)
+    {
+      if (copiesLeft == 0)
+      {
+        throw std::runtime_error("copy");
+      }
+      copiesLeft--;
+      created++;
+    }
+
+    Counted& operator=(const Counted&) = default;
+  };
+
+  size_t Counted::created = 0;
+  size_t Counted::copiesLeft = 0;
+}
+
+BOOST_AUTO_TEST_CASE(chunked_throwing_copy_test)
+{
+  Counted::copiesLeft = 100;
+  demehin::ChunkedArray< Counted > arr;
+  for (int i = 0; i < 5; i++)
+  {
+    arr.push(Counted(i));
+  }
+  Counted::copiesLeft = 2;
+  BOOST_CHECK_THROW(demehin::ChunkedArray< Counted > cpy(arr), std::runtime_error);
+  BOOST_TEST(arr.size() == 5);
+  BOOST_TEST(arr.back().value == 4);
+}
+
+BOOST_AUTO_TEST_CASE(queue_steady_size_test)
+{
+  demehin::Queue< Counted > queue;
+  for (int i = 0; i < 10; i++)
+  {
+    queue.push(Counted(i));
+  }
+  size_t created = Counted::created;
+  for (int i = 10; i < 100000; i++)
+  {
+    queue.pop();
+    queue.push(Counted(i));
+  }
+  BOOST_TEST(queue.size() == 10);
+  BOOST_TEST(queue.front().value == 99990);
+  BOOST_TEST(Counted::created - created == 99990);
+}
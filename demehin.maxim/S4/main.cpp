@@ -8,7 +8,7 @@
 namespace
 {
   using TreeMap = demehin::Tree< size_t, std::string >;
-  using MapOfTrees = demehin::Tree< std::string, TreeMap >;
+  using MapOfTrees = demehin::Tree< std::string, TreeMap, std::less<> >;
 
   void inputTrees(std::istream& in, MapOfTrees& mapOfTrees)
   {
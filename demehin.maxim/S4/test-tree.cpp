@@ -1,6 +1,7 @@
 #include <boost/test/unit_test.hpp>
 #include <sstream>
 #include <tree/tree.hpp>
+#include <merge_utils.hpp>
 
 namespace
 {
@@ -115,13 +116,13 @@ BOOST_AUTO_TEST_CASE(tree_modifiers_test)
   tree1.erase(++tree1.begin(), ++(++(++(tree1.begin()))));
   std::ostringstream out6;
   printTreeValues(out6, tree1);
-  BOOST_TEST(out6.str() == "1711");
+  BOOST_TEST(out6.str() == "111");
 
   tree2.insert(std::make_pair(3, "3"));
   tree1.insert(tree2.begin(), --tree2.end());
   std::ostringstream out7;
   printTreeValues(out7, tree1);
-  BOOST_TEST(out7.str() == "1234711");
+  BOOST_TEST(out7.str() == "123411");
 }
 
 BOOST_AUTO_TEST_CASE(hint_insertion_test)
@@ -145,6 +146,42 @@ BOOST_AUTO_TEST_CASE(hint_insertion_test)
   BOOST_TEST(tree.count(7) == 1);
 }
 
+BOOST_AUTO_TEST_CASE(order_statistics_test)
+{
+  demehin::Tree< size_t, std::string > tree;
+  for (size_t i = 0; i < 64; i++)
+  {
+    tree[(i * 37) % 64] = std::to_string(i);
+  }
+  for (size_t i = 0; i < 64; i += 3)
+  {
+    tree.erase(i);
+  }
+  tree.emplace_hint(tree.find(2), std::make_pair(3, "3"));
+
+  BOOST_TEST(tree.size() == 43);
+  BOOST_TEST((*tree.nth(0)).first == 1);
+  BOOST_TEST((*tree.nth(2)).first == 3);
+  BOOST_TEST((*tree.nth(42)).first == 62);
+  BOOST_TEST((tree.nth(43) == tree.end()));
+
+  BOOST_TEST(tree.rank(0) == 0);
+  BOOST_TEST(tree.rank(3) == 2);
+  BOOST_TEST(tree.rank(4) == 3);
+  BOOST_TEST(tree.rank(100) == 43);
+
+  BOOST_TEST(tree.distance(tree.begin(), tree.end()) == 43);
+  BOOST_TEST(tree.distance(tree.find(4), tree.find(8)) == 3);
+  BOOST_TEST(tree.distance(tree.find(62), tree.end()) == 1);
+
+  size_t i = 0;
+  for (auto it = tree.begin(); it != tree.end(); ++it, ++i)
+  {
+    BOOST_TEST((tree.nth(i) == it));
+    BOOST_TEST(tree.rank((*it).first) == i);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(element_access_test)
 {
   demehin::Tree< size_t, std::string > tree;
@@ -236,3 +273,174 @@ BOOST_AUTO_TEST_CASE(operators_test)
   BOOST_TEST(mv_tree.size() == 2);
   BOOST_TEST(out2.str() == "13");
 }
+
+BOOST_AUTO_TEST_CASE(merge_test)
+{
+  demehin::Tree< size_t, std::string > lhs{ { 1, "1" }, { 3, "3" }, { 5, "5" } };
+  demehin::Tree< size_t, std::string > rhs{ { 2, "2" }, { 3, "x" }, { 6, "6" } };
+
+  std::ostringstream out1;
+  demehin::mergeUnion(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), std::less< size_t >(),
+    [&out1](const std::pair< size_t, std::string >& value)
+    {
+      out1 << value.second;
+    });
+  BOOST_TEST(out1.str() == "12356");
+
+  std::ostringstream out2;
+  demehin::mergeIntersect(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), std::less< size_t >(),
+    [&out2](const std::pair< size_t, std::string >& value)
+    {
+      out2 << value.second;
+    });
+  BOOST_TEST(out2.str() == "3");
+
+  std::ostringstream out3;
+  demehin::mergeDifference(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), std::less< size_t >(),
+    [&out3](const std::pair< size_t, std::string >& value)
+    {
+      out3 << value.second;
+    });
+  BOOST_TEST(out3.str() == "15");
+}
+
+BOOST_AUTO_TEST_CASE(sorted_range_construct_test)
+{
+  demehin::Tree< size_t, std::string > tree;
+  for (size_t i = 0; i < 100; i++)
+  {
+    tree[(i * 37) % 100] = std::to_string(i);
+  }
+
+  demehin::Tree< size_t, std::string > sorted(tree.begin(), tree.end());
+  BOOST_TEST(sorted.size() == 100);
+  std::ostringstream out1;
+  std::ostringstream out2;
+  printTreeValues(out1, tree);
+  printTreeValues(out2, sorted);
+  BOOST_TEST(out1.str() == out2.str());
+  BOOST_TEST((*sorted.nth(42)).first == 42);
+  BOOST_TEST(sorted.rank(60) == 60);
+
+  sorted.erase(sorted.find(10), sorted.find(90));
+  sorted[50] = "50";
+  BOOST_TEST(sorted.size() == 21);
+  BOOST_TEST((*sorted.nth(10)).first == 50);
+
+  std::initializer_list< std::pair< const size_t, std::string > > unsorted = { { 3, "3" }, { 1, "1" }, { 2, "2" } };
+  demehin::Tree< size_t, std::string > fallback(unsorted.begin(), unsorted.end());
+  std::ostringstream out3;
+  printTreeValues(out3, fallback);
+  BOOST_TEST(out3.str() == "123");
+}
+
+BOOST_AUTO_TEST_CASE(split_join_test)
+{
+  using TreeMap = demehin::Tree< size_t, std::string >;
+  TreeMap tree;
+  for (size_t i = 0; i < 100; i++)
+  {
+    tree[(i * 37) % 100] = std::to_string((i * 37) % 100);
+  }
+
+  TreeMap tail = tree.split(60);
+  BOOST_TEST(tree.size() == 60);
+  BOOST_TEST(tail.size() == 40);
+  BOOST_TEST((*tree.nth(59)).first == 59);
+  BOOST_TEST((*tail.begin()).first == 60);
+  BOOST_TEST(tail.rank(75) == 15);
+
+  tree.join(tail);
+  BOOST_TEST(tail.empty());
+  BOOST_TEST(tree.size() == 100);
+
+  auto it = tree.erase(tree.find(10), tree.find(90));
+  BOOST_TEST((*it).first == 90);
+  BOOST_TEST(tree.size() == 20);
+  BOOST_TEST(tree.rank(90) == 10);
+  BOOST_TEST((tree.erase(tree.find(95), tree.end()) == tree.end()));
+  BOOST_TEST(tree.size() == 15);
+
+  TreeMap other{ { 50, "50" }, { 5, "x" }, { 94, "94" }, { 92, "92" } };
+  tree.insert(other.cbegin(), other.cend());
+  BOOST_TEST(tree.size() == 16);
+  BOOST_TEST(tree.at(5) == "5");
+  BOOST_TEST(tree.rank(92) == 13);
+
+  size_t i = 0;
+  for (auto iter = tree.begin(); iter != tree.end(); ++iter, ++i)
+  {
+    BOOST_TEST((tree.nth(i) == iter));
+  }
+  BOOST_TEST(i == 16);
+
+  tree.clear();
+  BOOST_TEST(tree.empty());
+  BOOST_TEST((tree.begin() == tree.end()));
+  tree[1] = "1";
+  BOOST_TEST(tree.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(join_order_test)
+{
+  using TreeMap = demehin::Tree< size_t, std::string >;
+  TreeMap tree{ { 1, "1" }, { 5, "5" } };
+  TreeMap overlap{ { 5, "x" }, { 7, "7" } };
+  BOOST_CHECK_THROW(tree.join(overlap), std::logic_error);
+  BOOST_TEST(tree.size() == 2);
+  BOOST_TEST(overlap.size() == 2);
+
+  TreeMap tail{ { 6, "6" } };
+  tree.join(tail);
+  std::ostringstream out;
+  printTreeValues(out, tree);
+  BOOST_TEST(out.str() == "156");
+}
+
+BOOST_AUTO_TEST_CASE(split_join_sizes_test)
+{
+  using TreeMap = demehin::Tree< size_t, std::string >;
+  TreeMap tree;
+  for (size_t i = 0; i < 1000; i++)
+  {
+    tree[(i * 389) % 1000] = "";
+  }
+  for (size_t key = 7; key < 1000; key += 97)
+  {
+    TreeMap tail = tree.split(key);
+    BOOST_TEST(tree.size() == key);
+    BOOST_TEST(tail.size() == 1000 - key);
+    TreeMap rest = tail.split(key + 50);
+    tail.join(rest);
+    tree.join(tail);
+    BOOST_TEST(tree.size() == 1000);
+  }
+  size_t i = 0;
+  for (auto it = tree.begin(); it != tree.end(); ++it, ++i)
+  {
+    BOOST_TEST((*it).first == i);
+    BOOST_TEST(tree.rank(i) == i);
+    BOOST_TEST((tree.nth(i) == it));
+  }
+  BOOST_TEST(i == 1000);
+}
+
+BOOST_AUTO_TEST_CASE(transparent_lookup_test)
+{
+  demehin::Tree< std::string, size_t, std::less<> > tree;
+  for (size_t i = 0; i < 50; i++)
+  {
+    tree[std::to_string(i)] = i;
+  }
+  const char* name = "42";
+  BOOST_TEST(tree.at(name) == 42);
+  BOOST_TEST((*tree.find("7")).second == 7);
+  BOOST_TEST(tree.count("7") == 1);
+  BOOST_TEST(tree.count("x") == 0);
+  BOOST_TEST((tree.find("x") == tree.end()));
+  BOOST_CHECK_THROW(tree.at("x"), std::out_of_range);
+
+  const auto& ctree = tree;
+  BOOST_TEST(ctree.at("13") == 13);
+  BOOST_TEST(ctree.at(std::string("14")) == 14);
+}
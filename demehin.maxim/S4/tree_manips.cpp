@@ -1,10 +1,30 @@
 #include "tree_manips.hpp"
+#include <functional>
+#include <memory>
+#include <utility>
+#include <merge_utils.hpp>
+#include <dynamic_array.hpp>
+
+namespace
+{
+  using SortedPairs = demehin::DynamicArray< std::pair< size_t, std::string > >;
+
+  struct ArrayAppender
+  {
+    SortedPairs& pairs;
+
+    void operator()(const std::pair< size_t, std::string >& value)
+    {
+      pairs.push(value);
+    }
+  };
+}
 
 void demehin::print(std::ostream& out, std::istream& in, const MapOfTrees& mapOfTrees)
 {
   std::string datasetName;
   in >> datasetName;
-  TreeMap map = mapOfTrees.at(datasetName);
+  const TreeMap& map = mapOfTrees.at(datasetName);
   if (map.empty())
   {
     out << "<EMPTY>\n";
@@ -23,97 +43,41 @@ void demehin::makeComplement(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, name1, name2;
   in >> newName >> name1 >> name2;
-  TreeMap newMap, map1, map2;
-  if (mapOfTrees.at(name1).size() > mapOfTrees.at(name2).size())
-  {
-    map1 = mapOfTrees.at(name1);
-    map2 = mapOfTrees.at(name2);
-  }
-  else
+  const TreeMap* map1 = std::addressof(mapOfTrees.at(name1));
+  const TreeMap* map2 = std::addressof(mapOfTrees.at(name2));
+  if (map1->size() <= map2->size())
   {
-    map1 = mapOfTrees.at(name2);
-    map2 = mapOfTrees.at(name1);
+    std::swap(map1, map2);
   }
 
-  for (auto&& key: map1)
-  {
-    if (map2.find(key.first) == map2.end())
-    {
-      newMap.insert(key);
-    }
-  }
-
-  if (newName == name1)
-  {
-    mapOfTrees[name1] = newMap;
-    return;
-  }
-  else if (newName == name2)
-  {
-    mapOfTrees[name2] = newMap;
-    return;
-  }
-
-  mapOfTrees[newName] = newMap;
+  SortedPairs merged;
+  mergeDifference(map1->cbegin(), map1->cend(), map2->cbegin(), map2->cend(),
+    std::less< size_t >(), ArrayAppender{ merged });
+  mapOfTrees[newName] = TreeMap(merged.begin(), merged.end());
 }
 
 void demehin::makeIntersect(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, lhsName, rhsName;
   in >> newName >> lhsName >> rhsName;
-  TreeMap newMap, lhsMap, rhsMap;
-  lhsMap = mapOfTrees.at(lhsName);
-  rhsMap = mapOfTrees.at(rhsName);
-  for (auto&& key: lhsMap)
-  {
-    if (rhsMap.find(key.first) != rhsMap.end())
-    {
-      newMap.insert(key);
-    }
-  }
+  const TreeMap& lhsMap = mapOfTrees.at(lhsName);
+  const TreeMap& rhsMap = mapOfTrees.at(rhsName);
 
-  if (newName == lhsName)
-  {
-    mapOfTrees[lhsName] = newMap;
-    return;
-  }
-  else if (newName == rhsName)
-  {
-    mapOfTrees[rhsName] = newMap;
-    return;
-  }
-  mapOfTrees[newName] = newMap;
+  SortedPairs merged;
+  mergeIntersect(lhsMap.cbegin(), lhsMap.cend(), rhsMap.cbegin(), rhsMap.cend(),
+    std::less< size_t >(), ArrayAppender{ merged });
+  mapOfTrees[newName] = TreeMap(merged.begin(), merged.end());
 }
 
 void demehin::makeUnion(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, lhsName, rhsName;
   in >> newName >> lhsName >> rhsName;
-  TreeMap newMap, lhsMap, rhsMap;
-  lhsMap = mapOfTrees.at(lhsName);
-  rhsMap = mapOfTrees.at(rhsName);
-  for (auto&& key: lhsMap)
-  {
-    newMap.insert(key);
-  }
-  for (auto&& key: rhsMap)
-  {
-    if (newMap.find(key.first) == newMap.end())
-    {
-      newMap.insert(key);
-    }
-  }
-
-  if (newName == lhsName)
-  {
-    mapOfTrees[lhsName] = newMap;
-    return;
-  }
-  else if (newName == rhsName)
-  {
-    mapOfTrees[rhsName] = newMap;
-    return;
-  }
+  const TreeMap& lhsMap = mapOfTrees.at(lhsName);
+  const TreeMap& rhsMap = mapOfTrees.at(rhsName);
 
-  mapOfTrees[newName] = newMap;
+  SortedPairs merged;
+  mergeUnion(lhsMap.cbegin(), lhsMap.cend(), rhsMap.cbegin(), rhsMap.cend(),
+    std::less< size_t >(), ArrayAppender{ merged });
+  mapOfTrees[newName] = TreeMap(merged.begin(), merged.end());
 }
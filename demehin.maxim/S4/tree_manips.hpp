@@ -7,7 +7,7 @@
 namespace demehin
 {
   using TreeMap = demehin::Tree< size_t, std::string >;
-  using MapOfTrees = demehin::Tree< std::string, TreeMap >;
+  using MapOfTrees = demehin::Tree< std::string, TreeMap, std::less<> >;
 
   void print(std::ostream& out, std::istream& in, const MapOfTrees& mapOfTrees);
   void makeComplement(std::istream& in, MapOfTrees& mapOfTrees);
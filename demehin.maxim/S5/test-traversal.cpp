@@ -78,3 +78,69 @@ BOOST_AUTO_TEST_CASE(traversal_big_tree_test)
   BOOST_TEST(rnl_res.str_res == "rightright right rightleft root leftright left leftleft");
   BOOST_TEST(br_res.str_res == "root left right leftleft leftright rightleft rightright");
 }
+
+BOOST_AUTO_TEST_CASE(breadth_iterator_test)
+{
+  demehin::Tree< int, int > tree;
+  BOOST_TEST((tree.cbrBegin() == tree.cbrEnd()));
+
+  for (int i = 0; i < 300; i++)
+  {
+    int key = (i * 53) % 300;
+    tree[key] = key;
+  }
+
+  std::ostringstream expected;
+  tree.const_traverse_breadth([&expected](const std::pair< int, int >& data)
+  {
+    expected << data.first << " ";
+  });
+
+  std::ostringstream actual;
+  size_t count = 0;
+  for (auto it = tree.cbrBegin(); it != tree.cbrEnd(); it++)
+  {
+    actual << it->first << " ";
+    count++;
+  }
+
+  BOOST_TEST(count == tree.size());
+  BOOST_TEST(actual.str() == expected.str());
+}
+
+namespace
+{
+  bool breadthMatchesTraversal(const demehin::Tree< long long, int >& tree)
+  {
+    std::ostringstream expected;
+    tree.const_traverse_breadth([&expected](const std::pair< long long, int >& data)
+    {
+      expected << data.first << " ";
+    });
+
+    std::ostringstream actual;
+    size_t count = 0;
+    for (auto it = tree.cbrBegin(); it != tree.cbrEnd() && count <= tree.size(); it++)
+    {
+      actual << it->first << " ";
+      count++;
+    }
+    return count == tree.size() && actual.str() == expected.str();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(breadth_iterator_copy_test)
+{
+  demehin::Tree< long long, int > tree;
+  for (int i = 0; i < 100; i++)
+  {
+    tree[(i * 37) % 100] = i;
+  }
+  tree.erase(0);
+  demehin::Tree< long long, int > copy(tree);
+  demehin::Tree< long long, int > assigned;
+  assigned = tree;
+
+  BOOST_TEST(breadthMatchesTraversal(copy));
+  BOOST_TEST(breadthMatchesTraversal(assigned));
+}
@@ -0,0 +1,273 @@
+#ifndef CHUNKED_ARRAY_HPP
+#define CHUNKED_ARRAY_HPP
+#include <cstddef>
+#include <algorithm>
+#include <new>
+#include <utility>
+#include <stdexcept>
+
+namespace demehin
+{
+  template< typename T >
+  class ChunkedArray
+  {
+  public:
+    ChunkedArray() noexcept;
+    ChunkedArray(const ChunkedArray&);
+    ChunkedArray(ChunkedArray&&) noexcept;
+
+    ChunkedArray< T >& operator=(const ChunkedArray< T >&);
+    ChunkedArray< T >& operator=(ChunkedArray< T >&&) noexcept;
+
+    ~ChunkedArray();
+
+    void push(const T& rhs);
+
+    void pop_back();
+    void pop_front();
+
+    const T& front() const;
+    T& front();
+    const T& back() const;
+    T& back();
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+
+    void swap(ChunkedArray&) noexcept;
+
+    void clear() noexcept;
+
+  private:
+    T** map_;
+    size_t mapCapacity_;
+    size_t firstBlock_;
+    size_t blockCount_;
+    size_t begin_;
+    size_t size_;
+
+    static constexpr size_t blockSize() noexcept;
+    T* slot(size_t) const noexcept;
+    void addBlock();
+  };
+
+  template< typename T >
+  constexpr size_t ChunkedArray< T >::blockSize() noexcept
+  {
+    return sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+  }
+
+  template< typename T >
+  ChunkedArray< T >::ChunkedArray() noexcept:
+    map_(nullptr),
+    mapCapacity_(0),
+    firstBlock_(0),
+    blockCount_(0),
+    begin_(0),
+    size_(0)
+  {}
+
+  template< typename T >
+  ChunkedArray< T >::ChunkedArray(const ChunkedArray& other):
+    ChunkedArray()
+  {
+    for (size_t i = 0; i < other.size_; i++)
+    {
+      push(*other.slot(i));
+    }
+  }
+
+  template< typename T >
+  ChunkedArray< T >::ChunkedArray(ChunkedArray&& other) noexcept:
+    map_(std::exchange(other.map_, nullptr)),
+    mapCapacity_(std::exchange(other.mapCapacity_, 0)),
+    firstBlock_(std::exchange(other.firstBlock_, 0)),
+    blockCount_(std::exchange(other.blockCount_, 0)),
+    begin_(std::exchange(other.begin_, 0)),
+    size_(std::exchange(other.size_, 0))
+  {}
+
+  template< typename T >
+  ChunkedArray< T >& ChunkedArray< T >::operator=(const ChunkedArray< T >& rhs)
+  {
+    if (this != std::addressof(rhs))
+    {
+      ChunkedArray< T > temp(rhs);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  template< typename T >
+  ChunkedArray< T >& ChunkedArray< T >::operator=(ChunkedArray< T >&& rhs) noexcept
+  {
+    if (this != std::addressof(rhs))
+    {
+      ChunkedArray< T > temp(std::move(rhs));
+      swap(temp);
+    }
+    return *this;
+  }
+
+  template< typename T >
+  ChunkedArray< T >::~ChunkedArray()
+  {
+    clear();
+    delete[] map_;
+  }
+
+  template< typename T >
+  T* ChunkedArray< T >::slot(size_t pos) const noexcept
+  {
+    pos += begin_;
+    return map_[firstBlock_ + pos / blockSize()] + pos % blockSize();
+  }
+
+  template< typename T >
+  void ChunkedArray< T >::addBlock()
+  {
+    if (firstBlock_ + blockCount_ == mapCapacity_)
+    {
+      if (blockCount_ < mapCapacity_ / 2)
+      {
+        std::copy(map_ + firstBlock_, map_ + firstBlock_ + blockCount_, map_);
+      }
+      else
+      {
+        size_t newCapacity = std::max< size_t >(mapCapacity_ * 2, 8);
+        T** newMap = new T*[newCapacity];
+        std::copy(map_ + firstBlock_, map_ + firstBlock_ + blockCount_, newMap);
+        delete[] map_;
+        map_ = newMap;
+        mapCapacity_ = newCapacity;
+      }
+      firstBlock_ = 0;
+    }
+    map_[firstBlock_ + blockCount_] = static_cast< T* >(::operator new(blockSize() * sizeof(T)));
+    blockCount_++;
+  }
+
+  template< typename T >
+  void ChunkedArray< T >::push(const T& value)
+  {
+    if (begin_ + size_ == blockCount_ * blockSize())
+    {
+      addBlock();
+    }
+    new (slot(size_)) T(value);
+    size_++;
+  }
+
+  template< typename T >
+  void ChunkedArray< T >::pop_back()
+  {
+    if (empty())
+    {
+      throw std::logic_error("empty");
+    }
+    slot(--size_)->~T();
+    if (begin_ + size_ <= (blockCount_ - 1) * blockSize())
+    {
+      ::operator delete(map_[firstBlock_ + --blockCount_]);
+    }
+  }
+
+  template< typename T >
+  void ChunkedArray< T >::pop_front()
+  {
+    if (empty())
+    {
+      throw std::logic_error("empty");
+    }
+    slot(0)->~T();
+    size_--;
+    if (++begin_ == blockSize())
+    {
+      ::operator delete(map_[firstBlock_++]);
+      blockCount_--;
+      begin_ = 0;
+    }
+  }
+
+  template< typename T >
+  const T& ChunkedArray< T >::front() const
+  {
+    if (empty())
+    {
+      throw std::logic_error("empty");
+    }
+    return *slot(0);
+  }
+
+  template< typename T >
+  T& ChunkedArray< T >::front()
+  {
+    if (empty())
+    {
+      throw std::logic_error("empty");
+    }
+    return *slot(0);
+  }
+
+  template< typename T >
+  const T& ChunkedArray< T >::back() const
+  {
+    if (empty())
+    {
+      throw std::logic_error("empty");
+    }
+    return *slot(size_ - 1);
+  }
+
+  template< typename T >
+  T& ChunkedArray< T >::back()
+  {
+    if (empty())
+    {
+      throw std::logic_error("empty");
+    }
+    return *slot(size_ - 1);
+  }
+
+  template< typename T >
+  bool ChunkedArray< T >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template< typename T >
+  size_t ChunkedArray< T >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template< typename T >
+  void ChunkedArray< T >::swap(ChunkedArray< T >& other) noexcept
+  {
+    std::swap(map_, other.map_);
+    std::swap(mapCapacity_, other.mapCapacity_);
+    std::swap(firstBlock_, other.firstBlock_);
+    std::swap(blockCount_, other.blockCount_);
+    std::swap(begin_, other.begin_);
+    std::swap(size_, other.size_);
+  }
+
+  template< typename T >
+  void ChunkedArray< T >::clear() noexcept
+  {
+    for (size_t i = 0; i < size_; i++)
+    {
+      slot(i)->~T();
+    }
+    for (size_t i = 0; i < blockCount_; i++)
+    {
+      ::operator delete(map_[firstBlock_ + i]);
+    }
+    firstBlock_ = 0;
+    blockCount_ = 0;
+    begin_ = 0;
+    size_ = 0;
+  }
+}
+
+#endif
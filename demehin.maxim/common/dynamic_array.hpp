@@ -1,6 +1,7 @@
 #ifndef DYNAMIC_ARRAY_HPP
 #define DYNAMIC_ARRAY_HPP
 #include <cstddef>
+#include <algorithm>
 #include <utility>
 #include <stdexcept>
 #include "data_utils.hpp"
@@ -76,10 +77,10 @@ namespace demehin
 
   template< typename T >
   DynamicArray< T >::DynamicArray(const DynamicArray& other):
-    data_(details::copyData(other.data_, other.size_)),
+    data_(details::copyData(other.data_ + other.begin_, other.size_, other.capacity_)),
     size_(other.size_),
     capacity_(other.capacity_),
-    begin_(other.begin_)
+    begin_(0)
   {}
 
   template< typename T >
@@ -133,11 +134,11 @@ namespace demehin
   template< typename T >
   void DynamicArray< T >::push(const T& value)
   {
-    if (size_ == capacity_)
+    if (begin_ + size_ == capacity_)
     {
       resize();
     }
-    data_[size_++] = value;
+    data_[begin_ + size_++] = value;
   }
 
   template< typename T >
@@ -246,10 +247,18 @@ namespace demehin
   template< typename T >
   void DynamicArray< T >::resize()
   {
-    capacity_ *= 2;
-    T* newData = details::copyData(data_, capacity_);
+    if (size_ < capacity_ / 2)
+    {
+      std::move(data_ + begin_, data_ + begin_ + size_, data_);
+      begin_ = 0;
+      return;
+    }
+    size_t newCapacity = std::max< size_t >(capacity_ * 2, 1);
+    T* newData = details::copyData(data_ + begin_, size_, newCapacity);
     delete[] data_;
     data_ = newData;
+    capacity_ = newCapacity;
+    begin_ = 0;
   }
 }
 
@@ -1,5 +1,6 @@
 #ifndef DYNAMIC_ARRAY_ITERATOR_HPP
 #define DYNAMIC_ARRAY_ITERATOR_HPP
+#include <iterator>
 
 namespace demehin
 {
@@ -7,7 +8,7 @@ namespace demehin
   class DynamicArray;
 
   template< typename T >
-  class DynamicArrayIterator
+  class DynamicArrayIterator: public std::iterator< std::bidirectional_iterator_tag, T >
   {
     friend class DynamicArray< T >;
   public:
@@ -0,0 +1,83 @@
+#ifndef MERGE_UTILS_HPP
+#define MERGE_UTILS_HPP
+
+namespace demehin
+{
+  template< typename InputIt1, typename InputIt2, typename Cmp, typename F >
+  F mergeUnion(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Cmp cmp, F f)
+  {
+    while (first1 != last1 && first2 != last2)
+    {
+      if (cmp(first2->first, first1->first))
+      {
+        f(*first2++);
+      }
+      else
+      {
+        if (!cmp(first1->first, first2->first))
+        {
+          first2++;
+        }
+        f(*first1++);
+      }
+    }
+    for (; first1 != last1; first1++)
+    {
+      f(*first1);
+    }
+    for (; first2 != last2; first2++)
+    {
+      f(*first2);
+    }
+    return f;
+  }
+
+  template< typename InputIt1, typename InputIt2, typename Cmp, typename F >
+  F mergeIntersect(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Cmp cmp, F f)
+  {
+    while (first1 != last1 && first2 != last2)
+    {
+      if (cmp(first1->first, first2->first))
+      {
+        first1++;
+      }
+      else if (cmp(first2->first, first1->first))
+      {
+        first2++;
+      }
+      else
+      {
+        f(*first1++);
+        first2++;
+      }
+    }
+    return f;
+  }
+
+  template< typename InputIt1, typename InputIt2, typename Cmp, typename F >
+  F mergeDifference(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Cmp cmp, F f)
+  {
+    while (first1 != last1 && first2 != last2)
+    {
+      if (cmp(first1->first, first2->first))
+      {
+        f(*first1++);
+      }
+      else
+      {
+        if (!cmp(first2->first, first1->first))
+        {
+          first1++;
+        }
+        first2++;
+      }
+    }
+    for (; first1 != last1; first1++)
+    {
+      f(*first1);
+    }
+    return f;
+  }
+}
+
+#endif
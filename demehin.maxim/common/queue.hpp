@@ -5,10 +5,11 @@
 #include <stdexcept>
 #include "data_utils.hpp"
 #include "dynamic_array.hpp"
+#include "chunked_array.hpp"
 
 namespace demehin
 {
-  template< typename T >
+  template< typename T, typename Container = DynamicArray< T > >
   class Queue
   {
   public:
@@ -17,8 +18,8 @@ namespace demehin
     Queue(const Queue&) = default;
     Queue(Queue&&) = default;
 
-    Queue< T >& operator=(const Queue< T >&) = default;
-    Queue< T >& operator=(Queue< T >&&) = default;
+    Queue& operator=(const Queue&) = default;
+    Queue& operator=(Queue&&) = default;
 
     ~Queue() = default;
 
@@ -35,59 +36,59 @@ namespace demehin
     void clear();
 
   private:
-    DynamicArray< T > data_;
+    Container data_;
   };
 
-  template< typename T >
-  void Queue< T >::push(const T& rhs)
+  template< typename T, typename Container >
+  void Queue< T, Container >::push(const T& rhs)
   {
     data_.push(rhs);
   }
 
-  template< typename T >
-  void Queue< T >::pop()
+  template< typename T, typename Container >
+  void Queue< T, Container >::pop()
   {
     data_.pop_front();
   }
 
-  template< typename T >
-  const T& Queue< T >::back() const
+  template< typename T, typename Container >
+  const T& Queue< T, Container >::back() const
   {
     return data_.back();
   }
 
-  template< typename T >
-  T& Queue< T >::back()
+  template< typename T, typename Container >
+  T& Queue< T, Container >::back()
   {
     return data_.back();
   }
 
-  template< typename T >
-  const T& Queue< T >::front() const
+  template< typename T, typename Container >
+  const T& Queue< T, Container >::front() const
   {
     return data_.front();
   }
 
-  template< typename T >
-  T& Queue< T >::front()
+  template< typename T, typename Container >
+  T& Queue< T, Container >::front()
   {
     return data_.front();
   }
 
-  template< typename T >
-  size_t Queue< T >::size() const noexcept
+  template< typename T, typename Container >
+  size_t Queue< T, Container >::size() const noexcept
   {
     return data_.size();
   }
 
-  template< typename T >
-  bool Queue< T >::empty() const noexcept
+  template< typename T, typename Container >
+  bool Queue< T, Container >::empty() const noexcept
   {
     return data_.empty();
   }
 
-  template< typename T >
-  void Queue< T >::clear()
+  template< typename T, typename Container >
+  void Queue< T, Container >::clear()
   {
     data_.clear();
   }
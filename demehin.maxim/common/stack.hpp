@@ -5,10 +5,11 @@
 #include <stdexcept>
 #include "data_utils.hpp"
 #include "dynamic_array.hpp"
+#include "chunked_array.hpp"
 
 namespace demehin
 {
-  template< typename T >
+  template< typename T, typename Container = DynamicArray< T > >
   class Stack
   {
   public:
@@ -16,8 +17,8 @@ namespace demehin
     Stack(const Stack&) = default;
     Stack(Stack&&) = default;
 
-    Stack< T >& operator=(const Stack< T >&) = default;
-    Stack< T >& operator=(Stack< T >&&) = default;
+    Stack& operator=(const Stack&) = default;
+    Stack& operator=(Stack&&) = default;
 
     ~Stack() = default;
 
@@ -30,41 +31,41 @@ namespace demehin
     size_t size() const noexcept;
 
   private:
-    DynamicArray< T > data_;
+    Container data_;
   };
 
-  template< typename T >
-  void Stack< T >::push(const T& rhs)
+  template< typename T, typename Container >
+  void Stack< T, Container >::push(const T& rhs)
   {
     data_.push(rhs);
   }
 
-  template< typename T >
-  const T& Stack< T >::top() const
+  template< typename T, typename Container >
+  const T& Stack< T, Container >::top() const
   {
     return data_.back();
   }
 
-  template< typename T >
-  T& Stack< T >::top()
+  template< typename T, typename Container >
+  T& Stack< T, Container >::top()
   {
     return data_.back();
   }
 
-  template< typename T >
-  void Stack< T >::pop()
+  template< typename T, typename Container >
+  void Stack< T, Container >::pop()
   {
     data_.pop_back();
   }
 
-  template< typename T >
-  bool Stack< T >::empty() const noexcept
+  template< typename T, typename Container >
+  bool Stack< T, Container >::empty() const noexcept
   {
     return data_.empty();
   }
 
-  template< typename T >
-  size_t Stack< T >::size() const noexcept
+  template< typename T, typename Container >
+  size_t Stack< T, Container >::size() const noexcept
   {
     return data_.size();
   }
@@ -1,9 +1,8 @@
 #ifndef BREADTH_ITERATOR_HPP
 #define BREADTH_ITERATOR_HPP
 #include <cassert>
+#include <cstddef>
 #include <tree/node.hpp>
-#include <queue.hpp>
-#include <queue>
 
 namespace demehin
 {
@@ -20,7 +19,6 @@ namespace demehin
     using Node = demehin::TreeNode< Key, T >;
     using this_t = BreadthIterator< Key, T, Cmp, isConst >;
     using node_t = typename std::conditional< isConst, const Node, Node >::type;
-    using queue_t = typename std::conditional< isConst, std::queue< const Node* >, std::queue< Node* > >::type;
     using data_t = typename std::conditional< isConst, const std::pair< Key, T >, std::pair< Key, T > >::type;
 
     BreadthIterator() noexcept;
@@ -36,53 +34,96 @@ namespace demehin
 
   private:
     node_t* node_;
-    queue_t queue_;
+    size_t level_;
 
     explicit BreadthIterator(node_t*) noexcept;
+    static bool isRoot(node_t*) noexcept;
+    static node_t* firstOnLevel(node_t*, size_t) noexcept;
+    static node_t* nextOnLevel(node_t*) noexcept;
   };
 
   template< typename Key, typename T, typename Cmp, bool isConst >
   BreadthIterator< Key, T, Cmp, isConst >::BreadthIterator() noexcept:
-    node_(nullptr)
+    node_(nullptr),
+    level_(0)
   {}
 
   template< typename Key, typename T, typename Cmp, bool isConst >
   BreadthIterator< Key, T, Cmp, isConst >::BreadthIterator(node_t* node) noexcept:
-    node_(node)
+    node_(node),
+    level_(0)
+  {}
+
+  template< typename Key, typename T, typename Cmp, bool isConst >
+  bool BreadthIterator< Key, T, Cmp, isConst >::isRoot(node_t* node) noexcept
   {
-    queue_.push(node_);
+    return node->parent == nullptr || node->parent->parent == nullptr;
   }
 
   template< typename Key, typename T, typename Cmp, bool isConst >
-  typename BreadthIterator< Key, T, Cmp, isConst >::this_t& BreadthIterator< Key, T, Cmp, isConst >::operator++() noexcept
+  typename BreadthIterator< Key, T, Cmp, isConst >::node_t* BreadthIterator< Key, T, Cmp, isConst >::firstOnLevel(node_t* top,
+    size_t level) noexcept
   {
-    if (queue_.empty())
-    {
-      node_ = nullptr;
-    }
-    else
+    node_t* node = top;
+    size_t depth = 0;
+    while (depth != level)
     {
-      node_ = queue_.front();
-      queue_.pop();
-      if (node_->left != nullptr)
+      if (node->left != nullptr || node->right != nullptr)
       {
-        queue_.push(node_->left);
+        node = (node->left != nullptr) ? node->left : node->right;
+        depth++;
+        continue;
       }
-      if (node_->right != nullptr)
+      while (node != top && (node == node->parent->right || node->parent->right == nullptr))
       {
-        queue_.push(node_->right);
+        node = node->parent;
+        depth--;
       }
-      if (queue_.empty())
+      if (node == top)
       {
-        node_ = nullptr;
+        return nullptr;
       }
-      else
+      node = node->parent->right;
+    }
+    return node;
+  }
+
+  template< typename Key, typename T, typename Cmp, bool isConst >
+  typename BreadthIterator< Key, T, Cmp, isConst >::node_t* BreadthIterator< Key, T, Cmp, isConst >::nextOnLevel(
+    node_t* node) noexcept
+  {
+    for (size_t up = 1; !isRoot(node); up++)
+    {
+      node_t* parent = node->parent;
+      if (node == parent->left && parent->right != nullptr)
       {
-        node_ = queue_.front();
+        node_t* next = firstOnLevel(parent->right, up - 1);
+        if (next != nullptr)
+        {
+          return next;
+        }
       }
+      node = parent;
     }
-    return *this;
+    return nullptr;
+  }
 
+  template< typename Key, typename T, typename Cmp, bool isConst >
+  typename BreadthIterator< Key, T, Cmp, isConst >::this_t& BreadthIterator< Key, T, Cmp, isConst >::operator++() noexcept
+  {
+    assert(node_ != nullptr);
+    node_t* next = nextOnLevel(node_);
+    if (next == nullptr)
+    {
+      node_t* root = node_;
+      while (!isRoot(root))
+      {
+        root = root->parent;
+      }
+      next = firstOnLevel(root, ++level_);
+    }
+    node_ = next;
+    return *this;
   }
 
   template< typename Key, typename T, typename Cmp, bool isConst >
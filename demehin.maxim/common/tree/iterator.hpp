@@ -1,6 +1,7 @@
 #ifndef ITERATOR_HPP
 #define ITERATOR_HPP
 #include <cassert>
+#include <iterator>
 #include "node.hpp"
 
 namespace demehin
@@ -12,7 +13,7 @@ namespace demehin
   class TreeConstIterator;
 
   template< typename Key, typename T, typename Cmp >
-  class TreeIterator
+  class TreeIterator: public std::iterator< std::bidirectional_iterator_tag, std::pair< Key, T > >
   {
     friend class Tree< Key, T, Cmp >;
     friend class TreeConstIterator< Key, T, Cmp >;
@@ -1,5 +1,6 @@
 #ifndef NODE_HPP
 #define NODE_HPP
+#include <cstddef>
 #include <utility>
 
 namespace demehin
@@ -12,6 +13,7 @@ namespace demehin
     TreeNode* left;
     TreeNode* right;
     int height;
+    size_t size;
 
     template< typename... Args >
     explicit TreeNode(Args&&... args) noexcept;
@@ -25,7 +27,8 @@ namespace demehin
     parent(nullptr),
     left(nullptr),
     right(nullptr),
-    height(1)
+    height(1),
+    size(1)
   {}
 }
 
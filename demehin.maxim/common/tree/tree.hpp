@@ -1,6 +1,8 @@
 #ifndef TREE_HPP
 #define TREE_HPP
 #include <functional>
+#include <iterator>
+#include <stdexcept>
 #include <utility>
 #include "node.hpp"
 #include "iterator.hpp"
@@ -53,10 +55,18 @@ namespace demehin
 
     T& at(const Key&);
     const T& at(const Key&) const;
+    template< typename K, typename C = Cmp, typename = typename C::is_transparent >
+    T& at(const K&);
+    template< typename K, typename C = Cmp, typename = typename C::is_transparent >
+    const T& at(const K&) const;
     T& operator[](const Key&);
 
     Iter find(const Key&) noexcept;
     cIter find(const Key&) const noexcept;
+    template< typename K, typename C = Cmp, typename = typename C::is_transparent >
+    Iter find(const K&) noexcept;
+    template< typename K, typename C = Cmp, typename = typename C::is_transparent >
+    cIter find(const K&) const noexcept;
 
     Iter begin() const noexcept;
     cIter cbegin() const noexcept;
@@ -68,6 +78,8 @@ namespace demehin
     void clear() noexcept;
 
     size_t count(const Key&) const noexcept;
+    template< typename K, typename C = Cmp, typename = typename C::is_transparent >
+    size_t count(const K&) const noexcept;
 
     Iter lower_bound(const Key&) noexcept;
     cIter lower_bound(const Key&) const noexcept;
@@ -76,6 +88,10 @@ namespace demehin
     IterPair equal_range(const Key&) noexcept;
     cIterPair equal_range(const Key&) const noexcept;
 
+    Iter nth(size_t) const noexcept;
+    size_t rank(const Key&) const noexcept;
+    size_t distance(cIter, cIter) const noexcept;
+
     template< typename... Args >
     std::pair< Iter, bool > emplace(Args&&...);
 
@@ -84,6 +100,9 @@ namespace demehin
 
     void swap(Tree< Key, T, Cmp >&) noexcept;
 
+    Tree< Key, T, Cmp > split(const Key&);
+    void join(Tree< Key, T, Cmp >&);
+
     LnrIter lnrBegin() const noexcept;
     LnrIter lnrEnd() const noexcept;
     cLnrIter clnrBegin() const noexcept;
@@ -132,9 +151,33 @@ namespace demehin
     void balanceUpper(Node*) noexcept;
     int getBalanceFactor(Node*) const noexcept;
     void updateHeight(Node*) noexcept;
+    size_t subtreeSize(Node*) const noexcept;
+    void updateSize(Node*) noexcept;
+    size_t position(Node*) const noexcept;
+    template< typename K >
+    Node* findNode(const K&) const noexcept;
+
+    Node* releaseRoot() noexcept;
+    void resetRoot(Node*) noexcept;
+    void clearNodes(Node*) noexcept;
+    Node* rebalanceSubtree(Node*, Node*) noexcept;
+    Node* joinNodes(Node*, Node*, Node*) noexcept;
+    Node* extractMin(Node*, Node*&) noexcept;
+    void splitNodes(Node*, const Key&, Node*&, Node*&) noexcept;
+    Node* unionNodes(Node*, Node*) noexcept;
+
+    template< typename InputIt >
+    void assignRange(InputIt, InputIt, std::input_iterator_tag);
+    template< typename FwdIt >
+    void assignRange(FwdIt, FwdIt, std::forward_iterator_tag);
+    template< typename FwdIt >
+    Node* buildSorted(FwdIt&, size_t);
 
     template< typename Iterator, typename F >
     F traverse(F, Iterator, Iterator) const;
+
+    template< typename NodeT, typename F >
+    F traverseBreadth(F) const;
   };
 
   template< typename Key, typename T, typename Cmp >
@@ -154,10 +197,7 @@ namespace demehin
   Tree< Key, T, Cmp >::Tree(InputIt first, InputIt last):
     Tree()
   {
-    for (auto it = first; it != last; it++)
-    {
-      insert(*it);
-    }
+    assignRange(first, last, typename std::iterator_traits< InputIt >::iterator_category());
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -179,6 +219,7 @@ namespace demehin
   {
     fakeRoot_->left = fakeRoot_->right = fakeRoot_;
     fakeRoot_->height = -1;
+    fakeRoot_->parent = nullptr;
     for (auto it = other.begin(); it != other.end(); it++)
     {
       insert(*it);
@@ -228,10 +269,7 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   void Tree< Key, T, Cmp >::clear() noexcept
   {
-    erase(cbegin(), cend());
-    fakeRoot_->left = fakeRoot_->right = fakeRoot_;
-    root_ = fakeRoot_;
-    size_ = 0;
+    clearNodes(releaseRoot());
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -250,12 +288,16 @@ namespace demehin
   template< typename InputIt >
   void Tree< Key, T, Cmp >::insert(InputIt first, InputIt last)
   {
-    Tree< Key, T, Cmp > temp(*this);
+    Tree< Key, T, Cmp > added;
+    added.cmp_ = cmp_;
     for (; first != last; first++)
     {
-      temp.insert(*first);
+      if (find(first->first) == end())
+      {
+        added.insert(*first);
+      }
     }
-    swap(temp);
+    resetRoot(unionNodes(releaseRoot(), added.releaseRoot()));
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -334,8 +376,17 @@ namespace demehin
       {
         Node* newNode = new Node(std::move(tempNode.data));
         Node* hintNode = hint.getNode();
-        newNode->parent = hintNode;
-        hintNode->right = newNode;
+        if (hintNode->right == nullptr)
+        {
+          newNode->parent = hintNode;
+          hintNode->right = newNode;
+        }
+        else
+        {
+          Node* nextNode = nextHint.getNode();
+          newNode->parent = nextNode;
+          nextNode->left = newNode;
+        }
         balanceUpper(newNode);
         size_++;
         return Iter(newNode);
@@ -359,6 +410,40 @@ namespace demehin
     }
   }
 
+  template< typename Key, typename T, typename Cmp >
+  size_t Tree< Key, T, Cmp >::subtreeSize(Node* node) const noexcept
+  {
+    return (node == fakeRoot_ || node == nullptr) ? 0 : node->size;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void Tree< Key, T, Cmp >::updateSize(Node* node) noexcept
+  {
+    if (node != fakeRoot_ && node != nullptr)
+    {
+      node->size = 1 + subtreeSize(node->left) + subtreeSize(node->right);
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t Tree< Key, T, Cmp >::position(Node* node) const noexcept
+  {
+    if (node == fakeRoot_)
+    {
+      return size_;
+    }
+    size_t pos = subtreeSize(node->left);
+    while (node->parent != fakeRoot_)
+    {
+      if (node->parent->right == node)
+      {
+        pos += subtreeSize(node->parent->left) + 1;
+      }
+      node = node->parent;
+    }
+    return pos;
+  }
+
   template< typename Key, typename T, typename Cmp >
   int Tree< Key, T, Cmp >::getBalanceFactor(Node* node) const noexcept
   {
@@ -382,7 +467,12 @@ namespace demehin
     lt->parent = node->parent;
     node->parent = lt;
     lt->right = node;
-    if (lt->parent != fakeRoot_)
+    if (lt->parent == fakeRoot_)
+    {
+      root_ = lt;
+      fakeRoot_->right = lt;
+    }
+    else if (lt->parent != nullptr)
     {
       if (lt->parent->left == node)
       {
@@ -393,14 +483,11 @@ namespace demehin
         lt->parent->right = lt;
       }
     }
-    else
-    {
-      root_ = lt;
-      fakeRoot_->right = lt;
-    }
 
     updateHeight(node);
     updateHeight(lt);
+    updateSize(node);
+    updateSize(lt);
 
     return lt;
   }
@@ -419,7 +506,12 @@ namespace demehin
     node->parent = rt;
     rt->left = node;
 
-    if (rt->parent != fakeRoot_)
+    if (rt->parent == fakeRoot_)
+    {
+      root_ = rt;
+      fakeRoot_->right = rt;
+    }
+    else if (rt->parent != nullptr)
     {
       if (rt->parent->left == node)
       {
@@ -430,14 +522,11 @@ namespace demehin
         rt->parent->right = rt;
       }
     }
-    else
-    {
-      root_ = rt;
-      fakeRoot_->right = rt;
-    }
 
     updateHeight(node);
     updateHeight(rt);
+    updateSize(node);
+    updateSize(rt);
 
     return rt;
   }
@@ -446,6 +535,7 @@ namespace demehin
   typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::balance(Node* node) noexcept
   {
     updateHeight(node);
+    updateSize(node);
     int balanceFactor = getBalanceFactor(node);
 
     if (balanceFactor > 1)
@@ -540,8 +630,10 @@ namespace demehin
 
     if (todelete == root_)
     {
-      root_ = (parent != fakeRoot_) ? parent : fakeRoot_;
-      result = begin();
+      Node* child = (todelete->left != nullptr) ? todelete->left : todelete->right;
+      root_ = (child != nullptr) ? child : fakeRoot_;
+      fakeRoot_->left = fakeRoot_->right = root_;
+      result = (todelete->right != nullptr) ? begin() : end();
     }
 
     delete todelete;
@@ -553,10 +645,26 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::erase(cIter first, cIter last) noexcept
   {
-    for (auto it = first; it != last;)
+    if (first == last)
+    {
+      return last;
+    }
+    Node* left = nullptr;
+    Node* middle = nullptr;
+    Node* right = nullptr;
+    splitNodes(releaseRoot(), first->first, left, middle);
+    if (last != cend())
+    {
+      splitNodes(middle, last->first, middle, right);
+    }
+    clearNodes(middle);
+    if (right != nullptr)
     {
-      it = erase(it);
+      Node* min = nullptr;
+      right = extractMin(right, min);
+      left = joinNodes(left, min, right);
     }
+    resetRoot(left);
     return last;
   }
 
@@ -637,6 +745,30 @@ namespace demehin
     return searched->second;
   }
 
+  template< typename Key, typename T, typename Cmp >
+  template< typename K, typename C, typename >
+  T& Tree< Key, T, Cmp >::at(const K& key)
+  {
+    auto searched = find(key);
+    if (searched == end())
+    {
+      throw std::out_of_range("key not found");
+    }
+    return searched->second;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename K, typename C, typename >
+  const T& Tree< Key, T, Cmp >::at(const K& key) const
+  {
+    auto searched = find(key);
+    if (searched == end())
+    {
+      throw std::out_of_range("key not found");
+    }
+    return searched->second;
+  }
+
   template< typename Key, typename T, typename Cmp >
   T& Tree< Key, T, Cmp >::operator[](const Key& key)
   {
@@ -647,27 +779,32 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::find(const Key& key) noexcept
   {
-    Node* current = root_;
-    while (current != nullptr && current != fakeRoot_)
-    {
-      if (cmp_(key, current->data.first))
-      {
-        current = current->left;
-      }
-      else if (cmp_(current->data.first, key))
-      {
-        current = current->right;
-      }
-      else
-      {
-        return Iter(current);
-      }
-    }
-    return end();
+    return Iter(findNode(key));
   }
 
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::find(const Key& key) const noexcept
+  {
+    return cIter(findNode(key));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename K, typename C, typename >
+  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::find(const K& key) noexcept
+  {
+    return Iter(findNode(key));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename K, typename C, typename >
+  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::find(const K& key) const noexcept
+  {
+    return cIter(findNode(key));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename K >
+  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::findNode(const K& key) const noexcept
   {
     Node* current = root_;
     while (current != nullptr && current != fakeRoot_)
@@ -682,10 +819,10 @@ namespace demehin
       }
       else
       {
-        return cIter(current);
+        return current;
       }
     }
-    return cend();
+    return fakeRoot_;
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -709,12 +846,326 @@ namespace demehin
     std::swap(size_, rhs.size_);
   }
 
+  template< typename Key, typename T, typename Cmp >
+  Tree< Key, T, Cmp > Tree< Key, T, Cmp >::split(const Key& key)
+  {
+    Tree< Key, T, Cmp > result;
+    result.cmp_ = cmp_;
+    Node* left = nullptr;
+    Node* right = nullptr;
+    splitNodes(releaseRoot(), key, left, right);
+    resetRoot(left);
+    result.resetRoot(right);
+    return result;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void Tree< Key, T, Cmp >::join(Tree< Key, T, Cmp >& rhs)
+  {
+    if (rhs.empty())
+    {
+      return;
+    }
+    if (!empty() && !cmp_((*(--end())).first, (*rhs.begin()).first))
+    {
+      throw std::logic_error("joined keys must follow the tree keys");
+    }
+    Node* right = rhs.releaseRoot();
+    Node* min = nullptr;
+    right = extractMin(right, min);
+    resetRoot(joinNodes(releaseRoot(), min, right));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::releaseRoot() noexcept
+  {
+    Node* root = (root_ == fakeRoot_) ? nullptr : root_;
+    if (root != nullptr)
+    {
+      root->parent = nullptr;
+    }
+    resetRoot(nullptr);
+    return root;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void Tree< Key, T, Cmp >::resetRoot(Node* root) noexcept
+  {
+    root_ = (root != nullptr) ? root : fakeRoot_;
+    fakeRoot_->left = fakeRoot_->right = root_;
+    if (root != nullptr)
+    {
+      root->parent = fakeRoot_;
+    }
+    size_ = subtreeSize(root);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void Tree< Key, T, Cmp >::clearNodes(Node* node) noexcept
+  {
+    while (node != nullptr)
+    {
+      if (node->left != nullptr)
+      {
+        Node* left = node->left;
+        node->left = left->right;
+        left->right = node;
+        node = left;
+      }
+      else
+      {
+        Node* right = node->right;
+        delete node;
+        node = right;
+      }
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename InputIt >
+  void Tree< Key, T, Cmp >::assignRange(InputIt first, InputIt last, std::input_iterator_tag)
+  {
+    for (auto it = first; it != last; it++)
+    {
+      insert(*it);
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename FwdIt >
+  void Tree< Key, T, Cmp >::assignRange(FwdIt first, FwdIt last, std::forward_iterator_tag)
+  {
+    if (first == last)
+    {
+      return;
+    }
+    size_t count = 1;
+    for (auto prev = first, it = std::next(first); it != last; prev++, it++, count++)
+    {
+      if (!cmp_(prev->first, it->first))
+      {
+        assignRange(first, last, std::input_iterator_tag());
+        return;
+      }
+    }
+    resetRoot(buildSorted(first, count));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename FwdIt >
+  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::buildSorted(FwdIt& it, size_t count)
+  {
+    if (count == 0)
+    {
+      return nullptr;
+    }
+    Node* left = buildSorted(it, count / 2);
+    Node* node = nullptr;
+    try
+    {
+      node = new Node(*it);
+      it++;
+      node->left = left;
+      left = nullptr;
+      node->right = buildSorted(it, count - 1 - count / 2);
+    }
+    catch (...)
+    {
+      clearNodes(left);
+      clearNodes(node);
+      throw;
+    }
+    if (node->left != nullptr)
+    {
+      node->left->parent = node;
+    }
+    if (node->right != nullptr)
+    {
+      node->right->parent = node;
+    }
+    updateHeight(node);
+    updateSize(node);
+    return node;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::rebalanceSubtree(Node* node, Node* top) noexcept
+  {
+    while (node != nullptr)
+    {
+      Node* parent = node->parent;
+      int oldHeight = node->height;
+      size_t oldSize = node->size;
+      Node* balanced = balance(node);
+      if (parent == nullptr)
+      {
+        return balanced;
+      }
+      if (balanced == node && node->height == oldHeight && node->size == oldSize)
+      {
+        return top;
+      }
+      node = parent;
+    }
+    return top;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::joinNodes(Node* left, Node* mid, Node* right) noexcept
+  {
+    Node* parent = nullptr;
+    Node* top = nullptr;
+    bool isLeft = false;
+    if (height(left) > height(right) + 1)
+    {
+      top = left;
+      size_t added = subtreeSize(right) + 1;
+      while (height(left) > height(right) + 1)
+      {
+        parent = left;
+        left->size += added;
+        left = left->right;
+      }
+    }
+    else if (height(right) > height(left) + 1)
+    {
+      top = right;
+      isLeft = true;
+      size_t added = subtreeSize(left) + 1;
+      while (height(right) > height(left) + 1)
+      {
+        parent = right;
+        right->size += added;
+        right = right->left;
+      }
+    }
+    mid->left = left;
+    mid->right = right;
+    mid->parent = parent;
+    if (left != nullptr)
+    {
+      left->parent = mid;
+    }
+    if (right != nullptr)
+    {
+      right->parent = mid;
+    }
+    updateHeight(mid);
+    updateSize(mid);
+    if (parent == nullptr)
+    {
+      return mid;
+    }
+    if (isLeft)
+    {
+      parent->left = mid;
+    }
+    else
+    {
+      parent->right = mid;
+    }
+    return rebalanceSubtree(parent, top);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::extractMin(Node* root, Node*& min) noexcept
+  {
+    min = root;
+    while (min->left != nullptr)
+    {
+      min->size--;
+      min = min->left;
+    }
+    Node* parent = min->parent;
+    Node* child = min->right;
+    if (child != nullptr)
+    {
+      child->parent = parent;
+    }
+    min->right = nullptr;
+    min->parent = nullptr;
+    if (parent == nullptr)
+    {
+      return child;
+    }
+    parent->left = child;
+    return rebalanceSubtree(parent, root);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void Tree< Key, T, Cmp >::splitNodes(Node* root, const Key& key, Node*& left, Node*& right) noexcept
+  {
+    if (root == nullptr)
+    {
+      left = right = nullptr;
+      return;
+    }
+    Node* rootLeft = root->left;
+    Node* rootRight = root->right;
+    if (rootLeft != nullptr)
+    {
+      rootLeft->parent = nullptr;
+    }
+    if (rootRight != nullptr)
+    {
+      rootRight->parent = nullptr;
+    }
+    root->left = root->right = root->parent = nullptr;
+    if (cmp_(root->data.first, key))
+    {
+      Node* rest = nullptr;
+      splitNodes(rootRight, key, rest, right);
+      left = joinNodes(rootLeft, root, rest);
+    }
+    else
+    {
+      Node* rest = nullptr;
+      splitNodes(rootLeft, key, left, rest);
+      right = joinNodes(rest, root, rootRight);
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::Node* Tree< Key, T, Cmp >::unionNodes(Node* lhs, Node* rhs) noexcept
+  {
+    if (rhs == nullptr)
+    {
+      return lhs;
+    }
+    if (lhs == nullptr)
+    {
+      return rhs;
+    }
+    Node* rhsLeft = rhs->left;
+    Node* rhsRight = rhs->right;
+    if (rhsLeft != nullptr)
+    {
+      rhsLeft->parent = nullptr;
+    }
+    if (rhsRight != nullptr)
+    {
+      rhsRight->parent = nullptr;
+    }
+    rhs->left = rhs->right = rhs->parent = nullptr;
+    Node* lhsLeft = nullptr;
+    Node* lhsRight = nullptr;
+    splitNodes(lhs, rhs->data.first, lhsLeft, lhsRight);
+    return joinNodes(unionNodes(lhsLeft, rhsLeft), rhs, unionNodes(lhsRight, rhsRight));
+  }
+
   template< typename Key, typename T, typename Cmp >
   size_t Tree< Key, T, Cmp >::count(const Key& key) const noexcept
   {
     return (find(key) != end());
   }
 
+  template< typename Key, typename T, typename Cmp >
+  template< typename K, typename C, typename >
+  size_t Tree< Key, T, Cmp >::count(const K& key) const noexcept
+  {
+    return (find(key) != end());
+  }
+
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::lower_bound(const Key& key) noexcept
   {
@@ -738,7 +1189,7 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::lower_bound(const Key& key) const noexcept
   {
-    return cIter(lower_bound(key));
+    return const_cast< Tree< Key, T, Cmp >* >(this)->lower_bound(key);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -764,7 +1215,7 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::upper_bound(const Key& key) const noexcept
   {
-    return cIter(upper_bound(key));
+    return const_cast< Tree< Key, T, Cmp >* >(this)->upper_bound(key);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -773,6 +1224,55 @@ namespace demehin
     return std::make_pair(lower_bound(key), upper_bound(key));
   }
 
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::nth(size_t k) const noexcept
+  {
+    if (k >= size_)
+    {
+      return end();
+    }
+    Node* current = root_;
+    while (k != subtreeSize(current->left))
+    {
+      if (k < subtreeSize(current->left))
+      {
+        current = current->left;
+      }
+      else
+      {
+        k -= subtreeSize(current->left) + 1;
+        current = current->right;
+      }
+    }
+    return Iter(current);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t Tree< Key, T, Cmp >::rank(const Key& key) const noexcept
+  {
+    Node* current = root_;
+    size_t res = 0;
+    while (current != fakeRoot_ && current != nullptr)
+    {
+      if (cmp_(current->data.first, key))
+      {
+        res += subtreeSize(current->left) + 1;
+        current = current->right;
+      }
+      else
+      {
+        current = current->left;
+      }
+    }
+    return res;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t Tree< Key, T, Cmp >::distance(cIter first, cIter last) const noexcept
+  {
+    return position(last.getNode()) - position(first.getNode());
+  }
+
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::LnrIter Tree< Key, T, Cmp >::lnrBegin() const noexcept
   {
@@ -848,7 +1348,7 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::BrIter Tree< Key, T, Cmp >::brBegin() const noexcept
   {
-    return BrIter(root_);
+    return BrIter(size_ == 0 ? nullptr : root_);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -860,7 +1360,7 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::cBrIter Tree< Key, T, Cmp >::cbrBegin() const noexcept
   {
-    return cBrIter(root_);
+    return cBrIter(size_ == 0 ? nullptr : root_);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -901,14 +1401,14 @@ namespace demehin
   template< typename F >
   F Tree< Key, T, Cmp >::traverse_breadth(F f) const
   {
-    return traverse(f, brBegin(), brEnd());
+    return traverseBreadth< Node >(f);
   }
 
   template< typename Key, typename T, typename Cmp >
   template< typename F >
   F Tree< Key, T, Cmp >::const_traverse_breadth(F f) const
   {
-    return traverse(f, cbrBegin(), cbrEnd());
+    return traverseBreadth< const Node >(f);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -921,6 +1421,43 @@ namespace demehin
     }
     return f;
   }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename NodeT, typename F >
+  F Tree< Key, T, Cmp >::traverseBreadth(F f) const
+  {
+    if (size_ == 0)
+    {
+      return f;
+    }
+    NodeT** queue = new NodeT*[size_];
+    size_t head = 0;
+    size_t tail = 0;
+    queue[tail++] = root_;
+    try
+    {
+      while (head != tail)
+      {
+        NodeT* node = queue[head++];
+        f(node->data);
+        if (node->left != nullptr)
+        {
+          queue[tail++] = node->left;
+        }
+        if (node->right != nullptr)
+        {
+          queue[tail++] = node->right;
+        }
+      }
+    }
+    catch (...)
+    {
+      delete[] queue;
+      throw;
+    }
+    delete[] queue;
+    return f;
+  }
 }
 
 #endif
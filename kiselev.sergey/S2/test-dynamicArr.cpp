@@ -1,6 +1,7 @@
 #include <boost/test/tools/interface.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
+#include <string>
 #include "dynamicArr.hpp"
 
 BOOST_AUTO_TEST_SUITE()
@@ -68,4 +69,31 @@ BOOST_AUTO_TEST_CASE(clear_and_size_and_empty)
   BOOST_TEST(arr.empty());
 }
 
+BOOST_AUTO_TEST_CASE(wrap_around)
+{
+  kiselev::DynamicArr< std::string > arr;
+  for (int i = 0; i < 5; ++i)
+  {
+    arr.push(std::to_string(i));
+  }
+  arr.popFront();
+  arr.popFront();
+  arr.push("5");
+  arr.push("6");
+  BOOST_TEST(arr.size() == 5);
+  BOOST_TEST(arr.front() == "2");
+  BOOST_TEST(arr.back() == "6");
+  arr.push("7");
+  kiselev::DynamicArr< std::string > copyArr(arr);
+  for (int i = 2; i < 8; ++i)
+  {
+    BOOST_TEST(arr.front() == std::to_string(i));
+    BOOST_TEST(copyArr.front() == std::to_string(i));
+    arr.popFront();
+    copyArr.popFront();
+  }
+  BOOST_TEST(arr.empty());
+  BOOST_TEST(copyArr.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
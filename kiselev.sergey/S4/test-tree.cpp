@@ -159,4 +159,38 @@ BOOST_AUTO_TEST_CASE(count_lowerBound_upperBound_equalRange)
   BOOST_CHECK(first == tree.equalRange(3).first);
   BOOST_CHECK(it == tree.equalRange(3).second);
 }
+
+BOOST_AUTO_TEST_CASE(nth_rank_distance)
+{
+  RBTree< size_t, std::string > tree;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    size_t key = (i * 61) % 100;
+    tree.insert({ key, std::to_string(key) });
+  }
+  for (size_t i = 0; i < 100; i += 4)
+  {
+    tree.erase(i);
+  }
+  tree.emplaceHint(tree.find(99), 100, "100");
+  BOOST_TEST(tree.size() == 76);
+  using ConstIterator = RBTree< size_t, std::string >::ConstIterator;
+  size_t index = 0;
+  for (ConstIterator it = tree.cbegin(); it != tree.cend(); ++it, ++index)
+  {
+    BOOST_CHECK(ConstIterator(tree.nth(index)) == it);
+    BOOST_TEST(tree.rank((*it).first) == index);
+    BOOST_TEST(tree.distance(tree.cbegin(), it) == index);
+    BOOST_TEST(tree.distance(it, tree.cend()) == 76 - index);
+  }
+  BOOST_TEST(tree.nth(3)->first == 5);
+  BOOST_CHECK(tree.nth(76) == tree.end());
+  BOOST_TEST(tree.rank(4) == 3);
+  const RBTree< size_t, std::string >& constTree = tree;
+  BOOST_TEST(constTree.distance(constTree.cbegin(), constTree.lowerBound(50)) == constTree.rank(50));
+  BOOST_TEST(constTree.distance(constTree.upperBound(50), constTree.cend()) == 76 - constTree.rank(51));
+  tree.clear();
+  tree.insert({ 1, "1" });
+  BOOST_TEST(tree.rank(2) == 1);
+}
 BOOST_AUTO_TEST_SUITE_END();
@@ -27,3 +27,27 @@ BOOST_AUTO_TEST_CASE(traverse)
   iss << funBreadth.sum << funBreadth.str;
   BOOST_TEST(iss.str() == "45 a b c d e");
 }
+
+BOOST_AUTO_TEST_CASE(breadth_iterator)
+{
+  RBTree< int, int > tree;
+  for (int i = 0; i < 200; ++i)
+  {
+    int key = (i * 37) % 200;
+    tree.insert(std::make_pair(key, key));
+  }
+  std::ostringstream expected;
+  tree.traverse_breadth([&expected](const std::pair< int, int >& data)
+  {
+    expected << data.first << ' ';
+  });
+  std::ostringstream actual;
+  size_t count = 0;
+  for (RBTree< int, int >::ConstBreadthIterator it = tree.breadthBegin(); it != tree.breadthCend(); it++)
+  {
+    actual << it->first << ' ';
+    ++count;
+  }
+  BOOST_TEST(count == tree.size());
+  BOOST_TEST(actual.str() == expected.str());
+}
@@ -3,7 +3,6 @@
 #include <cassert>
 #include <iterator>
 #include <utility>
-#include "queue.hpp"
 #include "treeNode.hpp"
 
 namespace kiselev
@@ -39,8 +38,10 @@ namespace kiselev
       bool operator!=(const BreadthIterator< Key, Value, Cmp, IsConst >&) const noexcept;
     private:
       Node* node_;
-      Queue< Node* > queue_;
+      size_t level_;
       explicit BreadthIterator(Node*) noexcept;
+      static Node* firstOnLevel(Node*, size_t) noexcept;
+      static Node* nextOnLevel(Node*) noexcept;
       friend class BreadthIterator< Key, Value, Cmp, !IsConst >;
       friend class RBTree< Key, Value, Cmp >;
     };
@@ -49,13 +50,13 @@ namespace kiselev
     template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
     BreadthIterator< Key, Value, Cmp, IsConst >::BreadthIterator(const BreadthIterator< Key, Value, Cmp, OtherIsConst >& oth):
       node_(oth.node_),
-      queue_(oth.queue_)
+      level_(oth.level_)
     {}
 
     template< typename Key, typename Value, typename Cmp, bool IsConst >
     BreadthIterator< Key, Value, Cmp, IsConst >::BreadthIterator() noexcept:
       node_(nullptr),
-      queue_()
+      level_(0)
     {}
 
     template< typename Key, typename Value, typename Cmp, bool IsConst >
@@ -64,45 +65,79 @@ namespace kiselev
       const BreadthIterator< Key, Value, Cmp, OtherIsConst >& oth)
     {
       node_ = oth.node_;
-      queue_ = oth.queue_;
+      level_ = oth.level_;
+      return *this;
     }
 
     template< typename Key, typename Value, typename Cmp, bool IsConst >
     BreadthIterator< Key, Value, Cmp, IsConst >::BreadthIterator(Node* node) noexcept:
       node_(node),
-      queue_()
+      level_(0)
+    {}
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    typename BreadthIterator< Key, Value, Cmp, IsConst >::Node* BreadthIterator< Key, Value, Cmp, IsConst >::firstOnLevel(
+      Node* top, size_t level) noexcept
     {
-      if (node)
+      Node* node = top;
+      size_t depth = 0;
+      while (depth != level)
       {
-        if (node_->left)
+        if (node->left || node->right)
+        {
+          node = node->left ? node->left : node->right;
+          ++depth;
+          continue;
+        }
+        while (node != top && (node == node->parent->right || !node->parent->right))
         {
-          queue_.push(node_->left);
+          node = node->parent;
+          --depth;
         }
-        if (node_->right)
+        if (node == top)
         {
-          queue_.push(node_->right);
+          return nullptr;
         }
+        node = node->parent->right;
       }
+      return node;
     }
 
     template< typename Key, typename Value, typename Cmp, bool IsConst >
-    BreadthIterator< Key, Value, Cmp, IsConst > BreadthIterator< Key, Value, Cmp, IsConst >::operator++()
+    typename BreadthIterator< Key, Value, Cmp, IsConst >::Node* BreadthIterator< Key, Value, Cmp, IsConst >::nextOnLevel(
+      Node* node) noexcept
     {
-      if (queue_.empty())
+      for (size_t up = 1; node->parent; ++up)
       {
-        node_ = nullptr;
-        return *this;
-      }
-      node_ = queue_.front();
-      queue_.pop();
-      if (node_->left)
-      {
-        queue_.push(node_->left);
+        Node* parent = node->parent;
+        if (node == parent->left && parent->right)
+        {
+          Node* next = firstOnLevel(parent->right, up - 1);
+          if (next)
+          {
+            return next;
+          }
+        }
+        node = parent;
       }
-      if (node_->right)
+      return nullptr;
+    }
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    BreadthIterator< Key, Value, Cmp, IsConst > BreadthIterator< Key, Value, Cmp, IsConst >::operator++()
+    {
+      assert(node_ != nullptr);
+      Node* next = nextOnLevel(node_);
+      if (!next)
       {
-        queue_.push(node_->right);
+        Node* root = node_;
+        while (root->parent)
+        {
+          root = root->parent;
+        }
+        next = firstOnLevel(root, ++level_);
       }
+      node_ = next;
       return *this;
     }
 
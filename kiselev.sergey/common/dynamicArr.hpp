@@ -1,5 +1,6 @@
 #ifndef DYNAMICARR_HPP
 #define DYNAMICARR_HPP
+#include <new>
 #include <stdexcept>
 #include <utility>
 
@@ -32,23 +33,38 @@ namespace kiselev
     bool empty() const noexcept;
 
   private:
-    T** data_;
+    T* data_;
     size_t capacity_;
     size_t size_;
     size_t begin_;
 
+    static T* allocate(size_t);
+    size_t index(size_t) const noexcept;
     void reallocate();
     void swap(DynamicArr< T >&) noexcept;
   };
 
+  template< typename T >
+  T* DynamicArr< T >::allocate(size_t capacity)
+  {
+    return static_cast< T* >(::operator new(capacity * sizeof(T)));
+  }
+
+  template< typename T >
+  size_t DynamicArr< T >::index(size_t i) const noexcept
+  {
+    size_t pos = begin_ + i;
+    return pos < capacity_ ? pos : pos - capacity_;
+  }
+
   template< typename T >
   void DynamicArr< T >::reallocate()
   {
-    size_t newCapacity = capacity_ * 2;
+    size_t newCapacity = capacity_ == 0 ? 5 : capacity_ * 2;
     DynamicArr< T > newArr(newCapacity);
-    for (size_t i = 0; i < size_; ++i)
+    for (; newArr.size_ < size_; ++newArr.size_)
     {
-      newArr.push(*data_[i + begin_]);
+      new (newArr.data_ + newArr.size_) T(std::move_if_noexcept(data_[index(newArr.size_)]));
     }
     swap(newArr);
   }
@@ -79,12 +95,12 @@ namespace kiselev
     size_(0),
     begin_(0)
   {
-    data_ = new T*[capacity_]();
+    data_ = allocate(capacity_);
   }
 
   template< typename T >
   DynamicArr< T >::DynamicArr(const DynamicArr< T >& arr):
-    data_(new T*[arr.capacity_]()),
+    data_(allocate(arr.capacity_)),
     capacity_(arr.capacity_),
     size_(0),
     begin_(0)
@@ -93,13 +109,13 @@ namespace kiselev
     {
       for (; size_ < arr.size(); ++size_)
       {
-        data_[size_] = new T(*arr.data_[size_ + arr.begin_]);
+        new (data_ + size_) T(arr.data_[arr.index(size_)]);
       }
     }
     catch (...)
     {
       clear();
-      delete[] data_;
+      ::operator delete(data_);
       throw;
     }
   }
@@ -114,7 +130,7 @@ namespace kiselev
 
   template< typename T >
   DynamicArr< T >::DynamicArr(size_t capacity):
-    data_(new T*[capacity]()),
+    data_(allocate(capacity)),
     capacity_(capacity),
     size_(0),
     begin_(0)
@@ -124,7 +140,7 @@ namespace kiselev
   DynamicArr< T >::~DynamicArr()
   {
     clear();
-    delete[] data_;
+    ::operator delete(data_);
     capacity_ = 0;
   }
 
@@ -157,7 +173,7 @@ namespace kiselev
     {
       throw std::logic_error("Empty for back()");
     }
-    return *(data_[begin_ + size_ - 1]);
+    return data_[index(size_ - 1)];
   }
 
   template< typename T >
@@ -167,7 +183,7 @@ namespace kiselev
     {
       throw std::logic_error("Empty for front()");
     }
-    return *(data_[begin_]);
+    return data_[begin_];
   }
 
   template< typename T >
@@ -183,8 +199,7 @@ namespace kiselev
     {
       throw std::logic_error("Empty for popBack()");
     }
-    delete data_[begin_ + size_ - 1];
-    data_[begin_ + size_ - 1] = nullptr;
+    data_[index(size_ - 1)].~T();
     --size_;
   }
 
@@ -195,9 +210,8 @@ namespace kiselev
     {
       throw std::logic_error("Empty for popFront()");
     }
-    delete data_[begin_];
-    data_[begin_] = nullptr;
-    ++begin_;
+    data_[begin_].~T();
+    begin_ = index(1);
     --size_;
     if (empty())
     {
@@ -212,7 +226,7 @@ namespace kiselev
     {
       reallocate();
     }
-    data_[begin_ + size_] = new T(data);
+    new (data_ + index(size_)) T(data);
     ++size_;
   }
 
@@ -223,7 +237,7 @@ namespace kiselev
     {
       reallocate();
     }
-    data_[begin_ + size_] = new T(std::move(data));
+    new (data_ + index(size_)) T(std::move(data));
     ++size_;
   }
 
@@ -107,6 +107,11 @@ namespace kiselev
     std::pair< Iterator, Iterator > equalRange(const Key&) noexcept;
     std::pair< ConstIterator, ConstIterator > equalRange(const Key&) const noexcept;
 
+    Iterator nth(size_t) noexcept;
+    ConstIterator nth(size_t) const noexcept;
+    size_t rank(const Key&) const noexcept;
+    size_t distance(ConstIterator first, ConstIterator last) const noexcept;
+
     TreeNode< Key, Value >* getMax() const noexcept;
 
   private:
@@ -115,7 +120,10 @@ namespace kiselev
     void rotateLeft(Node* node) noexcept;
     void rotateRight(Node* node) noexcept;
     void fixInsert(Node* node) noexcept;
-    void fixDelete(Node* node) noexcept;
+    void fixDelete(Node* node, Node* parent) noexcept;
+    static size_t sizeOf(const Node* node) noexcept;
+    static void updateSizes(Node* node, bool increase) noexcept;
+    size_t position(ConstIterator) const noexcept;
     Node* root_;
     Cmp cmp_;
     size_t size_;
@@ -218,6 +226,8 @@ namespace kiselev
     }
     child->left = node;
     node->parent = child;
+    child->size = node->size;
+    node->size = 1 + sizeOf(node->left) + sizeOf(node->right);
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -244,6 +254,8 @@ namespace kiselev
     }
     child->right = node;
     node->parent = child;
+    child->size = node->size;
+    node->size = 1 + sizeOf(node->left) + sizeOf(node->right);
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -306,24 +318,25 @@ namespace kiselev
   }
 
   template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::fixDelete(Node* node) noexcept
+  void RBTree< Key, Value, Cmp >::fixDelete(Node* node, Node* parent) noexcept
   {
-    while (node != root_ && node->color == Color::BLACK)
+    while (node != root_ && (!node || node->color == Color::BLACK))
     {
-      if (node == node->parent->left)
+      if (node == parent->left)
       {
-        Node* brother = node->parent->right;
+        Node* brother = parent->right;
         if (brother && brother->color == Color::RED)
         {
           brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateLeft(node->parent);
-          brother = node->parent->right;
+          parent->color = Color::RED;
+          rotateLeft(parent);
+          brother = parent->right;
         }
         if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
         {
           brother->color = Color::RED;
-          node = node->parent;
+          node = parent;
+          parent = node->parent;
         }
         else
         {
@@ -335,32 +348,34 @@ namespace kiselev
             }
             brother->color = Color::RED;
             rotateRight(brother);
-            brother = node->parent->right;
+            brother = parent->right;
           }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
+          brother->color = parent->color;
+          parent->color = Color::BLACK;
           if (brother->right)
           {
             brother->right->color = Color::BLACK;
           }
-          rotateLeft(node->parent);
+          rotateLeft(parent);
           node = root_;
+          parent = nullptr;
         }
       }
       else
       {
-        Node* brother = node->parent->left;
+        Node* brother = parent->left;
         if (brother && brother->color == Color::RED)
         {
           brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateRight(node->parent);
-          brother = node->parent->left;
+          parent->color = Color::RED;
+          rotateRight(parent);
+          brother = parent->left;
         }
         if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
         {
           brother->color = Color::RED;
-          node = node->parent;
+          node = parent;
+          parent = node->parent;
         }
         else
         {
@@ -372,16 +387,17 @@ namespace kiselev
             }
             brother->color = Color::RED;
             rotateLeft(brother);
-            brother = node->parent->left;
+            brother = parent->left;
           }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
+          brother->color = parent->color;
+          parent->color = Color::BLACK;
           if (brother->left)
           {
             brother->left->color = Color::BLACK;
           }
-          rotateRight(node->parent);
+          rotateRight(parent);
           node = root_;
+          parent = nullptr;
         }
       }
     }
@@ -608,10 +624,36 @@ namespace kiselev
   template< typename F >
   F RBTree< Key, Value, Cmp >::traverse_breadth(F f) const
   {
-    for (ConstBreadthIterator it = breadthCbegin(); it != breadthCend(); ++it)
+    if (!root_)
     {
-      f(*(it));
+      return f;
+    }
+    const Node** frontier = new const Node*[size_];
+    size_t head = 0;
+    size_t tail = 0;
+    frontier[tail++] = root_;
+    try
+    {
+      while (head != tail)
+      {
+        const Node* node = frontier[head++];
+        f(node->data);
+        if (node->left)
+        {
+          frontier[tail++] = node->left;
+        }
+        if (node->right)
+        {
+          frontier[tail++] = node->right;
+        }
+      }
     }
+    catch (...)
+    {
+      delete[] frontier;
+      throw;
+    }
+    delete[] frontier;
     return f;
   }
 
@@ -663,7 +705,7 @@ namespace kiselev
   template< typename... Args >
   std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::emplace(Args &&... args)
   {
-    Node* newNode = new Node{ Color::BLACK, nullptr, nullptr, nullptr, { std::forward< Args >(args)... } };
+    Node* newNode = new Node{ Color::BLACK, nullptr, nullptr, nullptr, 1, { std::forward< Args >(args)... } };
     try
     {
       if (!root_)
@@ -708,6 +750,7 @@ namespace kiselev
       delete newNode;
       throw;
     }
+    updateSizes(newNode->parent, true);
     fixInsert(newNode);
     size_++;
     return { Iterator(newNode, false), true };
@@ -722,7 +765,7 @@ namespace kiselev
       return emplace(std::forward< Args >(args)...).first;
     }
     Node* pos = hint.node_;
-    Node* newNode = new Node{ Color::RED, nullptr, nullptr, pos, { std::forward< Args >(args)... } };
+    Node* newNode = new Node{ Color::RED, nullptr, nullptr, pos, 1, { std::forward< Args >(args)... } };
     value val = newNode->data;
     try
     {
@@ -731,6 +774,7 @@ namespace kiselev
         if (!pos->left)
         {
           pos->left = newNode;
+          updateSizes(pos, true);
           fixInsert(newNode);
           ++size_;
           return Iterator(newNode, false);
@@ -741,6 +785,7 @@ namespace kiselev
         if (!pos->right)
         {
           pos->right = newNode;
+          updateSizes(pos, true);
           fixInsert(newNode);
           ++size_;
           return Iterator(newNode, false);
@@ -822,9 +867,11 @@ namespace kiselev
     Node* child = nullptr;
     if (size_ == 1)
     {
+      Iterator last(root_, true);
       delete root_;
+      root_ = nullptr;
       size_ = 0;
-      return end();
+      return last;
     }
     if (!toDelete->left || !toDelete->right)
     {
@@ -859,9 +906,10 @@ namespace kiselev
     {
       toDelete->data = std::move(replace->data);
     }
+    updateSizes(replace->parent, false);
     if (replace->color == Color::BLACK)
     {
-      fixDelete(child ? child : replace->parent);
+      fixDelete(child, replace->parent);
     }
     Iterator next(pos.node_, pos.isEnd_);
     ++next;
@@ -937,7 +985,7 @@ namespace kiselev
   template< typename Key, typename Value, typename Cmp >
   typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::lowerBound(const Key& key) const noexcept
   {
-    return ConstIterator(lowerBound(key));
+    return ConstIterator(const_cast< RBTree< Key, Value, Cmp >* >(this)->lowerBound(key));
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -963,7 +1011,7 @@ namespace kiselev
   template< typename Key, typename Value, typename Cmp >
   typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::upperBound(const Key& key) const noexcept
   {
-    return ConstIterator(upperBound(key));
+    return ConstIterator(const_cast< RBTree< Key, Value, Cmp >* >(this)->upperBound(key));
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -978,6 +1026,102 @@ namespace kiselev
     return { ConstIterator(lowerBound(key)), ConstIterator(upperBound(key)) };
   }
 
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::nth(size_t index) noexcept
+  {
+    if (index >= size_)
+    {
+      return end();
+    }
+    Node* temp = root_;
+    while (index != sizeOf(temp->left))
+    {
+      if (index < sizeOf(temp->left))
+      {
+        temp = temp->left;
+      }
+      else
+      {
+        index -= sizeOf(temp->left) + 1;
+        temp = temp->right;
+      }
+    }
+    return Iterator(temp, false);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::nth(size_t index) const noexcept
+  {
+    return ConstIterator(const_cast< RBTree< Key, Value, Cmp >* >(this)->nth(index));
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t RBTree< Key, Value, Cmp >::rank(const Key& key) const noexcept
+  {
+    size_t result = 0;
+    Node* temp = root_;
+    while (temp)
+    {
+      if (cmp_(temp->data.first, key))
+      {
+        result += sizeOf(temp->left) + 1;
+        temp = temp->right;
+      }
+      else
+      {
+        temp = temp->left;
+      }
+    }
+    return result;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t RBTree< Key, Value, Cmp >::distance(ConstIterator first, ConstIterator last) const noexcept
+  {
+    return position(last) - position(first);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t RBTree< Key, Value, Cmp >::position(ConstIterator it) const noexcept
+  {
+    if (it.isEnd_)
+    {
+      return size_;
+    }
+    Node* temp = it.node_;
+    size_t result = sizeOf(temp->left);
+    for (; temp->parent; temp = temp->parent)
+    {
+      if (temp == temp->parent->right)
+      {
+        result += sizeOf(temp->parent->left) + 1;
+      }
+    }
+    return result;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t RBTree< Key, Value, Cmp >::sizeOf(const Node* node) noexcept
+  {
+    return node ? node->size : 0;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::updateSizes(Node* node, bool increase) noexcept
+  {
+    for (; node; node = node->parent)
+    {
+      if (increase)
+      {
+        ++node->size;
+      }
+      else
+      {
+        --node->size;
+      }
+    }
+  }
+
   template< typename Key, typename Value, typename Cmp >
   const Value& RBTree< Key, Value, Cmp >::operator[](const Key& key) const
   {
@@ -1,5 +1,6 @@
 #ifndef TREENODE_HPP
 #define TREENODE_HPP
+#include <cstddef>
 #include <utility>
 
 namespace kiselev
@@ -16,6 +17,7 @@ namespace kiselev
     TreeNode* left;
     TreeNode* right;
     TreeNode* parent;
+    size_t size;
     std::pair< Key, Value > data;
   };
 }
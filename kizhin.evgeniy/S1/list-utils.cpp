@@ -2,29 +2,19 @@
 #include <limits>
 #include <stdexcept>
 
+namespace {
+  struct PushColumn
+  {
+    kizhin::ForwardList< kizhin::NumbersT >& result;
+    void operator()(const kizhin::NumbersT& column) { result.pushBack(column); }
+  };
+}
+
 kizhin::ForwardList< kizhin::NumbersT > kizhin::transpose(
     const ForwardList< NumbersT >& source)
 {
-  using NumberIter = NumbersT::const_iterator;
-  ForwardList< std::pair< NumberIter, NumberIter > > iters;
-  for (const auto& nums: source) {
-    iters.emplaceBack(nums.begin(), nums.end());
-  }
   ForwardList< NumbersT > result;
-  bool isEmpty = false;
-  while (!isEmpty) {
-    NumbersT current;
-    for (auto& pair: iters) {
-      if (pair.first != pair.second) {
-        current.pushBack(*pair.first);
-        ++pair.first;
-      }
-    }
-    isEmpty = current.empty();
-    if (!isEmpty) {
-      result.pushBack(std::move(current));
-    }
-  }
+  forEachColumn(source, PushColumn{ result });
   return result;
 }
 
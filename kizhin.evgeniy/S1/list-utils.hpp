@@ -1,12 +1,15 @@
 #ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S1_LIST_UTILS_HPP
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S1_LIST_UTILS_HPP
 
+#include <iterator>
 #include <forward-list.hpp>
 #include "type-utils.hpp"
 
 namespace kizhin {
   NumbersT::value_type safeAccumulate(const NumbersT&, NumbersT::value_type = {});
   ForwardList< NumbersT > transpose(const ForwardList< NumbersT >&);
+  template < typename F >
+  F forEachColumn(const ForwardList< NumbersT >&, F);
   struct is_empty_list
   {
     bool operator()(const NumbersT& nums) { return nums.empty(); }
@@ -14,5 +17,32 @@ namespace kizhin {
 
 }
 
+template < typename F >
+F kizhin::forEachColumn(const ForwardList< NumbersT >& source, F func)
+{
+  using NumberIter = NumbersT::const_iterator;
+  ForwardList< std::pair< NumberIter, NumberIter > > iters;
+  for (const auto& nums: source) {
+    if (!nums.empty()) {
+      iters.emplaceBack(nums.begin(), nums.end());
+    }
+  }
+  NumbersT current;
+  while (!iters.empty()) {
+    current.clear();
+    auto prev = iters.beforeBegin();
+    for (auto i = iters.begin(); i != iters.end();) {
+      current.pushBack(*i->first);
+      if (++i->first == i->second) {
+        i = std::next(iters.eraseAfter(prev));
+      } else {
+        prev = i++;
+      }
+    }
+    func(static_cast< const NumbersT& >(current));
+  }
+  return func;
+}
+
 #endif
 
@@ -3,6 +3,19 @@
 #include "io-utils.hpp"
 #include "list-utils.hpp"
 
+namespace {
+  struct OutputColumn
+  {
+    std::ostream& out;
+    kizhin::ForwardList< kizhin::NumbersT::value_type >& sums;
+    void operator()(const kizhin::NumbersT& column)
+    {
+      kizhin::outputList(out, column) << '\n';
+      sums.pushBack(kizhin::safeAccumulate(column));
+    }
+  };
+}
+
 int main()
 {
   using namespace kizhin;
@@ -12,7 +25,6 @@ int main()
     if (!inputSequences(std::cin, names, numbers)) {
       throw std::logic_error("Failed to input");
     }
-    numbers = transpose(numbers);
     outputList(std::cout, names);
     if (!names.empty()) {
       std::cout << '\n';
@@ -22,13 +34,7 @@ int main()
       return 0;
     }
     ForwardList< NumbersT::value_type > sums;
-    for (const auto& num: numbers) {
-      outputList(std::cout, num);
-      if (!num.empty()) {
-        std::cout << '\n';
-      }
-      sums.pushBack(safeAccumulate(num));
-    }
+    forEachColumn(numbers, OutputColumn{ std::cout, sums });
     outputList(std::cout, sums);
     if (!sums.empty()) {
       std::cout << '\n';
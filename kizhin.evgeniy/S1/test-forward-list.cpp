@@ -692,6 +692,48 @@ BOOST_AUTO_TEST_CASE(sort_comparator)
   BOOST_TEST(list == expected);
 }
 
+BOOST_AUTO_TEST_CASE(sort_runs)
+{
+  ListT sorted{ 1, 2, 2, 3, 4, 5 };
+  const ListT expected(sorted);
+  sorted.sort();
+  testForwardListInvariants(sorted);
+  BOOST_TEST(sorted == expected);
+
+  ListT reversed{ 5, 4, 3, 2, 2, 1 };
+  reversed.sort();
+  testForwardListInvariants(reversed);
+  BOOST_TEST(reversed == expected);
+
+  ListT runs{ 4, 5, 2, 1, 3, 2, 6, 0 };
+  runs.sort();
+  runs.pushBack(7);
+  testForwardListInvariants(runs);
+  BOOST_TEST(runs == ListT({ 0, 1, 2, 2, 3, 4, 5, 6, 7 }));
+}
+
+BOOST_AUTO_TEST_CASE(sort_stable)
+{
+  ListT list;
+  for (int i = 0; i < 300; ++i) {
+    list.pushBack((i * 37) % 10 + i / 1000.0);
+  }
+  const auto byIntegerPart = [](double lhs, double rhs) -> bool
+  {
+    return static_cast< int >(lhs) < static_cast< int >(rhs);
+  };
+  list.sort(byIntegerPart);
+  testForwardListInvariants(list);
+  BOOST_TEST(list.size() == 300);
+  ListT::const_iterator prev = list.begin();
+  for (ListT::const_iterator it = std::next(prev); it != list.end(); prev = it++) {
+    BOOST_TEST(!byIntegerPart(*it, *prev));
+    if (!byIntegerPart(*prev, *it)) {
+      BOOST_TEST(*prev < *it);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 BOOST_AUTO_TEST_SUITE(comparison_operators);
 
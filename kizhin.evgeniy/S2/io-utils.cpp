@@ -60,13 +60,22 @@ std::istream& kizhin::operator>>(std::istream& in, Token& token)
 
 kizhin::PostfixExpression kizhin::inputPostfixExpression(std::istream& in)
 {
+  Stack< Token > operations;
+  Queue< Token > expression;
+  inputPostfixExpression(in, expression, operations);
+  return PostfixExpression(std::move(expression));
+}
+
+std::istream& kizhin::inputPostfixExpression(std::istream& in, Queue< Token >& expression,
+    Stack< Token >& operations)
+{
+  expression.clear();
+  operations.clear();
   StreamGuard guard(in);
   std::istream::sentry s(in);
   if (!s) {
-    return PostfixExpression(Queue< Token >());
+    return in;
   }
-  Stack< Token > operations;
-  Queue< Token > expression;
   Token token;
   while (in >> token) {
     if (token.type() == TokenType::number) {
@@ -102,7 +111,7 @@ kizhin::PostfixExpression kizhin::inputPostfixExpression(std::istream& in)
     expression.push(operations.top());
     operations.pop();
   }
-  return PostfixExpression(expression);
+  return in;
 }
 
 kizhin::Token kizhin::constructToken(const char symbol)
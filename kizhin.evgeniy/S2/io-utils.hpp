@@ -7,6 +7,7 @@
 namespace kizhin {
   std::istream& operator>>(std::istream&, Token&);
   PostfixExpression inputPostfixExpression(std::istream&);
+  std::istream& inputPostfixExpression(std::istream&, Queue< Token >&, Stack< Token >&);
   class StreamGuard;
 }
 
@@ -2,7 +2,9 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
-#include <forward-list.hpp>
+#include <buffer.hpp>
+#include <queue.hpp>
+#include <stack.hpp>
 #include "io-utils.hpp"
 #include "postfix-expression.hpp"
 
@@ -24,20 +26,22 @@ int main(int argc, char** argv)
     }
     std::istream& in = fin.is_open() ? fin : std::cin;
     std::string current;
-    ForwardList< PostfixExpression::number_type > results;
+    std::istringstream stream;
+    Queue< Token > expression;
+    Stack< Token > operations;
+    Stack< PostfixExpression::number_type > operands;
+    Buffer< PostfixExpression::number_type > results;
     while (std::getline(in, current)) {
       if (!current.empty()) {
-        std::stringstream stream(current);
-        results.pushFront(inputPostfixExpression(stream).evaluate());
+        stream.clear();
+        stream.str(current);
+        inputPostfixExpression(stream, expression, operations);
+        results.pushBack(evaluatePostfix(expression, operands));
       }
     }
-    if (!results.empty()) {
-      std::cout << results.front();
-      results.popFront();
-    }
-    while (!results.empty()) {
-      std::cout << ' ' << results.front();
-      results.popFront();
+    for (auto i = results.end(); i != results.begin();) {
+      --i;
+      std::cout << *i << (i != results.begin() ? " " : "");
     }
     std::cout << '\n';
   } catch (const std::exception& e) {
@@ -1,6 +1,7 @@
 #ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_FORWARD_LIST_HPP
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_FORWARD_LIST_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <initializer_list>
 #include <memory>
@@ -102,10 +103,20 @@ namespace kizhin {
 
   private:
     using Node = detail::Node< value_type >;
+    struct Run
+    {
+      Node* head;
+      Node* tail;
+    };
 
     Node* beforeBegin_;
     Node* end_;
     size_type size_;
+
+    template < typename Comparator >
+    static Run extractRun(Node*&, Comparator&);
+    template < typename Comparator >
+    static Run mergeRuns(Run, Run, Comparator&);
   };
 
   template < typename T >
@@ -629,16 +640,82 @@ namespace kizhin {
     if (size_ <= 1) {
       return;
     }
-    const iterator mid = std::next(begin(), size_ / 2);
-    ForwardList< T > left;
-    ForwardList< T > right;
-    left.spliceAfter(left.beforeBegin(), *this, beforeBegin(), mid);
-    right.spliceAfter(right.beforeBegin(), *this, beforeBegin(), end());
-
-    left.sort(comp);
-    right.sort(comp);
-    merge(left, comp);
-    merge(right, comp);
+    constexpr size_type maxBuckets = 64;
+    Run buckets[maxBuckets] = {};
+    size_type filled = 0;
+    Node* rest = beforeBegin_->next;
+    while (rest != nullptr) {
+      Run carry = extractRun(rest, comp);
+      size_type i = 0;
+      for (; i < filled && buckets[i].head != nullptr; ++i) {
+        carry = mergeRuns(buckets[i], carry, comp);
+        buckets[i].head = nullptr;
+      }
+      assert(i < maxBuckets);
+      buckets[i] = carry;
+      filled = std::max(filled, i + 1);
+    }
+    Run result = buckets[0];
+    for (size_type i = 1; i < filled; ++i) {
+      if (buckets[i].head == nullptr) {
+        continue;
+      }
+      result = result.head == nullptr ? buckets[i] : mergeRuns(buckets[i], result, comp);
+    }
+    beforeBegin_->next = result.head;
+    end_ = result.tail;
+  }
+
+  template < typename T >
+  template < typename Comparator >
+  typename ForwardList< T >::Run ForwardList< T >::extractRun(Node*& list, Comparator& comp)
+  {
+    Run run{ list, list };
+    list = list->next;
+    if (list != nullptr && comp(list->data, run.head->data)) {
+      run.tail->next = nullptr;
+      while (list != nullptr && comp(list->data, run.head->data)) {
+        Node* next = list->next;
+        list->next = run.head;
+        run.head = list;
+        list = next;
+      }
+      return run;
+    }
+    while (list != nullptr && !comp(list->data, run.tail->data)) {
+      run.tail = list;
+      list = list->next;
+    }
+    run.tail->next = nullptr;
+    return run;
+  }
+
+  template < typename T >
+  template < typename Comparator >
+  typename ForwardList< T >::Run ForwardList< T >::mergeRuns(Run lhs, Run rhs, Comparator& comp)
+  {
+    Node* head = nullptr;
+    if (comp(rhs.head->data, lhs.head->data)) {
+      head = std::exchange(rhs.head, rhs.head->next);
+    } else {
+      head = std::exchange(lhs.head, lhs.head->next);
+    }
+    Node* tail = head;
+    while (lhs.head != nullptr && rhs.head != nullptr) {
+      if (comp(rhs.head->data, lhs.head->data)) {
+        tail->next = rhs.head;
+        tail = std::exchange(rhs.head, rhs.head->next);
+      } else {
+        tail->next = lhs.head;
+        tail = std::exchange(lhs.head, lhs.head->next);
+      }
+    }
+    if (lhs.head != nullptr) {
+      tail->next = lhs.head;
+      return { head, lhs.tail };
+    }
+    tail->next = rhs.head;
+    return { head, rhs.tail };
   }
 }
 
@@ -28,6 +28,7 @@ namespace kizhin {
     reference back() noexcept;
     const_reference back() const noexcept;
     void pop() noexcept;
+    void clear() noexcept;
 
     void push(const_reference);
     void push(value_type&&);
@@ -94,6 +95,12 @@ namespace kizhin {
     container_.popFront();
   }
 
+  template < typename T, typename C >
+  void Queue< T, C >::clear() noexcept
+  {
+    container_.clear();
+  }
+
   template < typename T, typename C >
   void Queue< T, C >::push(const_reference value)
   {
@@ -26,6 +26,7 @@ namespace kizhin {
     reference top() noexcept;
     const_reference top() const noexcept;
     void pop() noexcept;
+    void clear() noexcept;
 
     void push(const_reference);
     void push(value_type&&);
@@ -80,6 +81,12 @@ namespace kizhin {
     container_.popFront();
   }
 
+  template < typename T, typename C >
+  void Stack< T, C >::clear() noexcept
+  {
+    container_.clear();
+  }
+
   template < typename T, typename C >
   void Stack< T, C >::push(const_reference value)
   {
@@ -1,6 +1,10 @@
 #ifndef QUEUE_STACK_BASE_HPP
 #define QUEUE_STACK_BASE_HPP
 
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace maslevtsov {
@@ -31,9 +35,14 @@ namespace maslevtsov {
     T* data_;
     std::size_t size_, first_, capacity_;
 
+    static T* allocate(std::size_t capacity);
     template< class U >
     void push_impl(U&& value);
-    void expand_data(std::size_t new_capacity);
+    void copy_data(T* new_data, std::true_type) const noexcept;
+    void copy_data(T* new_data, std::false_type) const;
+    void relocate_data(T* new_data, std::true_type) noexcept;
+    void relocate_data(T* new_data, std::false_type);
+    void destroy_data() noexcept;
   };
 
   template< class T, bool is_pop_front >
@@ -46,25 +55,18 @@ namespace maslevtsov {
 
   template< class T, bool is_pop_front >
   QueueStackBase< T, is_pop_front >::QueueStackBase(const QueueStackBase& rhs):
-    data_(new T[rhs.capacity_]),
-    size_(rhs.size_),
+    data_(allocate(rhs.capacity_)),
+    size_(0),
     first_(0),
     capacity_(rhs.capacity_)
   {
     try {
-      if (is_pop_front) {
-        for (std::size_t i = 0, j = rhs.first_; i != capacity_; ++i, j = (j + 1) % capacity_) {
-          data_[i] = rhs.data_[j];
-        }
-      } else {
-        for (std::size_t i = 0; i != capacity_; ++i) {
-          data_[i] = rhs.data_[i];
-        }
-      }
+      rhs.copy_data(data_, std::is_trivially_copyable< T >{});
     } catch (...) {
-      delete[] data_;
+      ::operator delete(data_);
       throw;
     }
+    size_ = rhs.size_;
   }
 
   template< class T, bool is_pop_front >
@@ -78,7 +80,8 @@ namespace maslevtsov {
   template< class T, bool is_pop_front >
   QueueStackBase< T, is_pop_front >::~QueueStackBase()
   {
-    delete[] data_;
+    destroy_data();
+    ::operator delete(data_);
   }
 
   template< class T, bool is_pop_front >
@@ -93,7 +96,7 @@ namespace maslevtsov {
   QueueStackBase< T, is_pop_front >& QueueStackBase< T, is_pop_front >::operator=(QueueStackBase&& rhs) noexcept
   {
     QueueStackBase< T, is_pop_front > moved(std::move(rhs));
-    swap(rhs);
+    swap(moved);
     return *this;
   }
 
@@ -137,7 +140,10 @@ namespace maslevtsov {
   void QueueStackBase< T, is_pop_front >::pop() noexcept
   {
     if (is_pop_front) {
+      data_[first_].~T();
       first_ = (first_ + 1) % capacity_;
+    } else {
+      data_[size_ - 1].~T();
     }
     --size_;
   }
@@ -151,38 +157,99 @@ namespace maslevtsov {
     std::swap(capacity_, other.capacity_);
   }
 
+  template< class T, bool is_pop_front >
+  T* QueueStackBase< T, is_pop_front >::allocate(std::size_t capacity)
+  {
+    return capacity ? static_cast< T* >(::operator new(capacity * sizeof(T))) : nullptr;
+  }
+
   template< class T, bool is_pop_front >
   template< class U >
   void QueueStackBase< T, is_pop_front >::push_impl(U&& value)
   {
-    if (size_ == capacity_) {
-      expand_data(size_ * 2 + 1);
+    if (size_ != capacity_) {
+      new (data_ + (first_ + size_) % capacity_) T(std::forward< U >(value));
+      ++size_;
+      return;
     }
-    data_[size_++] = std::forward< U >(value);
+    std::size_t new_capacity = capacity_ * 2 + 1;
+    T* new_data = allocate(new_capacity);
+    try {
+      new (new_data + size_) T(std::forward< U >(value));
+    } catch (...) {
+      ::operator delete(new_data);
+      throw;
+    }
+    try {
+      relocate_data(new_data, std::is_trivially_copyable< T >{});
+    } catch (...) {
+      new_data[size_].~T();
+      ::operator delete(new_data);
+      throw;
+    }
+    ::operator delete(data_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+    first_ = 0;
+    ++size_;
   }
 
   template< class T, bool is_pop_front >
-  void QueueStackBase< T, is_pop_front >::expand_data(std::size_t new_capacity)
+  void QueueStackBase< T, is_pop_front >::copy_data(T* new_data, std::true_type) const noexcept
   {
-    T* new_data = new T[new_capacity];
+    if (size_ == 0) {
+      return;
+    }
+    std::size_t head = std::min(size_, capacity_ - first_);
+    std::memcpy(new_data, data_ + first_, head * sizeof(T));
+    std::memcpy(new_data + head, data_, (size_ - head) * sizeof(T));
+  }
+
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::copy_data(T* new_data, std::false_type) const
+  {
+    std::size_t i = 0;
     try {
-      if (is_pop_front) {
-        for (std::size_t i = 0, j = first_; i != capacity_; ++i, j = (j + 1) % capacity_) {
-          new_data[i] = data_[j];
-        }
-      } else {
-        for (std::size_t i = 0; i != capacity_; ++i) {
-          new_data[i] = data_[i];
-        }
+      for (; i != size_; ++i) {
+        new (new_data + i) T(data_[(first_ + i) % capacity_]);
       }
     } catch (...) {
-      delete[] new_data;
+      for (std::size_t j = 0; j != i; ++j) {
+        new_data[j].~T();
+      }
       throw;
     }
-    delete[] data_;
-    data_ = new_data;
-    capacity_ = new_capacity;
-    first_ = 0;
+  }
+
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::relocate_data(T* new_data, std::true_type) noexcept
+  {
+    copy_data(new_data, std::true_type{});
+  }
+
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::relocate_data(T* new_data, std::false_type)
+  {
+    std::size_t i = 0;
+    try {
+      for (; i != size_; ++i) {
+        new (new_data + i) T(std::move_if_noexcept(data_[(first_ + i) % capacity_]));
+      }
+    } catch (...) {
+      for (std::size_t j = 0; j != i; ++j) {
+        new_data[j].~T();
+      }
+      throw;
+    }
+    destroy_data();
+  }
+
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::destroy_data() noexcept
+  {
+    for (std::size_t i = 0; i != size_; ++i) {
+      data_[(first_ + i) % capacity_].~T();
+    }
   }
 }
 
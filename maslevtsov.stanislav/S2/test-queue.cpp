@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <string>
 #include "queue.hpp"
 
 BOOST_AUTO_TEST_SUITE(queue_constructors_tests)
@@ -106,4 +107,24 @@ BOOST_AUTO_TEST_CASE(queue_swap_test)
   BOOST_TEST(s2.front() == 1);
   BOOST_TEST(s2.size() == 1);
 }
+
+BOOST_AUTO_TEST_CASE(queue_wrap_around_test)
+{
+  maslevtsov::Queue< std::string > q;
+  q.push("1");
+  q.push("2");
+  q.pop();
+  q.push("3");
+  q.push("4");
+  q.push("5");
+  maslevtsov::Queue< std::string > copied(q);
+  for (int i = 2; i <= 5; ++i) {
+    BOOST_TEST(q.front() == std::to_string(i));
+    BOOST_TEST(copied.front() == std::to_string(i));
+    q.pop();
+    copied.pop();
+  }
+  BOOST_TEST(q.empty());
+  BOOST_TEST(copied.empty());
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -127,8 +127,15 @@ namespace rychkov
 
     template< class C >
     bool compare(const List& rhs, C comp) const;
+    struct run_t
+    {
+      node_t< value_type >* head;
+      node_t< value_type >* tail;
+    };
     template< class C >
-    const_iterator merge_sort(C& compare, const_iterator& from, size_t size_);
+    static run_t extract_run(C& compare, node_t< value_type >*& from);
+    template< class C >
+    static run_t merge_runs(C& compare, run_t left, run_t right);
     template< class C >
     const_iterator unsafeMerge(C& compare, const_iterator& from, const_iterator to,
         const_iterator insfrom, const_iterator insto);
@@ -3,6 +3,7 @@
 
 #include "declaration.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <utility>
 
@@ -45,25 +46,105 @@ void rychkov::List< T >::sort(C compare)
   {
     return;
   }
-  const_iterator from = begin();
-  const_iterator to = merge_sort(compare, from, size_);
-  head_ = from.node_;
-  tail_ = to.node_;
+  constexpr size_t max_buckets = 64;
+  run_t buckets[max_buckets] = {};
+  size_t filled = 0;
+  node_t< value_type >* rest = head_;
+  while (rest != nullptr)
+  {
+    run_t carry = extract_run(compare, rest);
+    size_t i = 0;
+    for (; (i < filled) && (buckets[i].head != nullptr); i++)
+    {
+      carry = merge_runs(compare, buckets[i], carry);
+      buckets[i].head = nullptr;
+    }
+    buckets[i] = carry;
+    filled = std::max(filled, i + 1);
+  }
+  run_t result = buckets[0];
+  for (size_t i = 1; i < filled; i++)
+  {
+    if (buckets[i].head != nullptr)
+    {
+      result = (result.head == nullptr) ? buckets[i] : merge_runs(compare, buckets[i], result);
+    }
+  }
+  head_ = result.head;
+  tail_ = result.tail;
   head_->prev = nullptr;
-  tail_->next = nullptr;
 }
 template< class T >
 template< class C >
-typename rychkov::List< T >::const_iterator rychkov::List< T >::merge_sort(C& compare, const_iterator& from, size_t count)
+typename rychkov::List< T >::run_t rychkov::List< T >::extract_run(C& compare, node_t< value_type >*& from)
 {
-  if (count == 1)
+  run_t result = {from, from};
+  from = from->next;
+  if ((from != nullptr) && compare(from->data, result.head->data))
+  {
+    result.tail->next = nullptr;
+    while ((from != nullptr) && compare(from->data, result.head->data))
+    {
+      node_t< value_type >* next = from->next;
+      result.head->prev = from;
+      from->next = result.head;
+      result.head = from;
+      from = next;
+    }
+    return result;
+  }
+  while ((from != nullptr) && !compare(from->data, result.tail->data))
+  {
+    result.tail = from;
+    from = from->next;
+  }
+  result.tail->next = nullptr;
+  return result;
+}
+template< class T >
+template< class C >
+typename rychkov::List< T >::run_t rychkov::List< T >::merge_runs(C& compare, run_t left, run_t right)
+{
+  node_t< value_type >* l = left.head;
+  node_t< value_type >* r = right.head;
+  node_t< value_type >* head = nullptr;
+  if (compare(r->data, l->data))
+  {
+    head = r;
+    r = r->next;
+  }
+  else
+  {
+    head = l;
+    l = l->next;
+  }
+  node_t< value_type >* tail = head;
+  while ((l != nullptr) && (r != nullptr))
+  {
+    if (compare(r->data, l->data))
+    {
+      tail->next = r;
+      r->prev = tail;
+      tail = r;
+      r = r->next;
+    }
+    else
+    {
+      tail->next = l;
+      l->prev = tail;
+      tail = l;
+      l = l->next;
+    }
+  }
+  if (l != nullptr)
   {
-    return from;
+    tail->next = l;
+    l->prev = tail;
+    return {head, left.tail};
   }
-  const_iterator mid = merge_sort(compare, from, (count + 1) / 2);
-  const_iterator postMid = ++const_iterator{mid};
-  const_iterator to = merge_sort(compare, postMid, count / 2);
-  return unsafeMerge(compare, from, mid, postMid, to);
+  tail->next = r;
+  r->prev = tail;
+  return {head, right.tail};
 }
 template< class T >
 template< class C >
@@ -8,6 +8,42 @@ BOOST_AUTO_TEST_CASE(sort_test)
   list.sort();
   rychkov::fullCompare(list, {-3, -1, 3, 4, 4, 6, 7});
 }
+BOOST_AUTO_TEST_CASE(sort_runs_test)
+{
+  rychkov::List< int > sorted = {-2, 0, 0, 3, 5};
+  sorted.sort();
+  rychkov::fullCompare(sorted, {-2, 0, 0, 3, 5});
+  rychkov::List< int > reversed = {5, 3, 0, 0, -2};
+  reversed.sort();
+  rychkov::fullCompare(reversed, {-2, 0, 0, 3, 5});
+  rychkov::List< int > runs = {4, 5, 2, 1, 3, 2, 6, 0};
+  runs.sort(std::greater<>());
+  rychkov::fullCompare(runs, {6, 5, 4, 3, 2, 2, 1, 0});
+}
+BOOST_AUTO_TEST_CASE(sort_stable_test)
+{
+  rychkov::List< int > list;
+  for (int i = 0; i < 300; i++)
+  {
+    list.push_back((i * 37) % 10 * 1000 + i);
+  }
+  list.sort([](int lhs, int rhs)
+    {
+      return lhs / 1000 < rhs / 1000;
+    });
+  rychkov::List< int > expected;
+  for (int key = 0; key < 10; key++)
+  {
+    for (int i = 0; i < 300; i++)
+    {
+      if ((i * 37) % 10 == key)
+      {
+        expected.push_back(key * 1000 + i);
+      }
+    }
+  }
+  rychkov::fullCompare(list, expected);
+}
 BOOST_AUTO_TEST_CASE(merge_test)
 {
   rychkov::List< int > list1 = {-1, 3, 4, 6, 7};
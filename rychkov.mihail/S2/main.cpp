@@ -100,10 +100,11 @@ int main(int argc, char** argv)
 
   in >> std::noskipws;
   Stack< long long > results;
+  Queue< Variant< long long, Operator > > expression;
+  Stack< Operator > operators;
+  Stack< long long > operands;
   while (!in.eof())
   {
-    Queue< Variant< long long, Operator > > expression;
-    Stack< Operator > operators;
     bool isNumber = false;
     long long number = 0;
     char c = 0;
@@ -168,7 +169,7 @@ int main(int argc, char** argv)
       continue;
     }
 
-    Stack< long long > operands;
+    operands.clear();
     if (!rychkov::holds_alternative< long long >(expression.front()))
     {
       std::cerr << "expression does not start with number\n";
@@ -81,6 +81,7 @@ template< class T, bool PopFromTail >
 rychkov::details::QueueBase< T, PopFromTail >::~QueueBase()
 {
   clear();
+  delete[] raw_;
 }
 template< class T, bool PopFromTail >
 rychkov::details::QueueBase< T, PopFromTail >&
@@ -137,11 +138,7 @@ void rychkov::details::QueueBase< T, PopFromTail >::clear()
   {
     pop();
   }
-  delete[] raw_;
-  capacity_ = 0;
   head_ = 0;
-  data_ = nullptr;
-  raw_ = nullptr;
 }
 template< class T, bool PopFromTail >
 void rychkov::details::QueueBase< T, PopFromTail >::push(const value_type& value)
@@ -76,4 +76,20 @@ BOOST_AUTO_TEST_CASE(destructors_leak_test)
   queue.pop();
 }
 
+BOOST_AUTO_TEST_CASE(clear_keeps_storage_test)
+{
+  rychkov::Queue< int > queue;
+  queue.push(1);
+  queue.push(2);
+  queue.push(3);
+  queue.pop();
+  size_t capacity = queue.capacity();
+  queue.clear();
+  BOOST_TEST(queue.empty());
+  BOOST_TEST(queue.capacity() == capacity);
+  queue.push(4);
+  queue.push(5);
+  BOOST_TEST(queue.front() == 4);
+  BOOST_TEST(queue.capacity() == capacity);
+}
 BOOST_AUTO_TEST_SUITE_END()
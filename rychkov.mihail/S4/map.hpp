@@ -6,10 +6,17 @@
 
 namespace rychkov
 {
-  template< class K, class T, class C = std::less<>, size_t N = 2 >
-  using Map = MapBase< K, T, C, N, false, false >;
-  template< class K, class T, class C = std::less<>, size_t N = 2 >
-  using MultiMap = MapBase< K, T, C, N, false, true >;
+  template< class K, class T, class C = std::less<>, size_t N = 2, class A = PoolAllocator< std::pair< const K, T > > >
+  using Map = MapBase< K, T, C, N, false, false, A >;
+  template< class K, class T, class C = std::less<>, size_t N = 2, class A = PoolAllocator< std::pair< const K, T > > >
+  using MultiMap = MapBase< K, T, C, N, false, true, A >;
+
+  template< class K, class T, class C = std::less<>, size_t N = cache_fit_capacity_v< std::pair< K, T > >,
+      class A = PoolAllocator< std::pair< const K, T > > >
+  using WideMap = MapBase< K, T, C, N, false, false, A >;
+  template< class K, class T, class C = std::less<>, size_t N = cache_fit_capacity_v< std::pair< K, T > >,
+      class A = PoolAllocator< std::pair< const K, T > > >
+  using WideMultiMap = MapBase< K, T, C, N, false, true, A >;
 }
 
 #endif
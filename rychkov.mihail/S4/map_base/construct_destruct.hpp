@@ -3,35 +3,40 @@
 
 #include "declaration.hpp"
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase()
+#include <new>
+
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::MapBase()
     noexcept(std::is_nothrow_default_constructible< value_compare >::value):
   comp_(),
   cached_begin_(fake_root()),
   cached_rbegin_(fake_root()),
   size_(0),
+  alloc_(),
   fake_parent_(nullptr),
   fake_children_{nullptr},
   fake_size_(0)
 {}
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(value_compare key)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::MapBase(value_compare key)
     noexcept(std::is_nothrow_move_constructible< value_compare >::value):
   comp_(std::move(key)),
   cached_begin_(fake_root()),
   cached_rbegin_(fake_root()),
   size_(0),
+  alloc_(),
   fake_parent_(nullptr),
   fake_children_{nullptr},
   fake_size_(0)
 {}
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(MapBase&& rhs)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::MapBase(MapBase&& rhs)
     noexcept(std::is_nothrow_move_constructible< value_compare >::value):
   comp_(std::move(rhs.comp_)),
   cached_begin_(std::exchange(rhs.cached_begin_, rhs.fake_root())),
   cached_rbegin_(std::exchange(rhs.cached_rbegin_, rhs.fake_root())),
   size_(std::exchange(rhs.size_, 0)),
+  alloc_(std::move(rhs.alloc_)),
   fake_parent_(nullptr),
   fake_children_{std::exchange(rhs.fake_children_[0], nullptr)},
   fake_size_(0)
@@ -45,18 +50,38 @@ rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(MapBase&& rhs)
     fake_children_[0]->parent = fake_root();
   }
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(const MapBase& rhs):
-  MapBase(rhs.begin(), rhs.end(), rhs.comp_)
-{}
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::MapBase(const MapBase& rhs):
+  comp_(rhs.comp_),
+  cached_begin_(fake_root()),
+  cached_rbegin_(fake_root()),
+  size_(0),
+  alloc_(node_allocator_traits::select_on_container_copy_construction(rhs.alloc_)),
+  fake_parent_(nullptr),
+  fake_children_{nullptr},
+  fake_size_(0)
+{
+  if (rhs.size_ == 0)
+  {
+    return;
+  }
+  reserve_nodes(count_nodes(rhs.fake_children_[0]), is_pool_allocator< node_allocator >{});
+  fake_children_[0] = copy_subtree(rhs.fake_children_[0], fake_root());
+  size_ = rhs.size_;
+  for (cached_begin_ = fake_children_[0]; !cached_begin_->isleaf(); cached_begin_ = cached_begin_->children[0])
+  {}
+  for (cached_rbegin_ = fake_children_[0]; !cached_rbegin_->isleaf();
+      cached_rbegin_ = cached_rbegin_->children[cached_rbegin_->size()])
+  {}
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::MapBase
     (std::initializer_list< value_type > init, value_compare compare):
   MapBase(init.begin(), init.end(), std::move(compare))
 {}
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class InputIt >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(InputIt from, InputIt to, value_compare compare):
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::MapBase(InputIt from, InputIt to, value_compare compare):
   MapBase(std::move(compare))
 {
   for (; from != to; ++from)
@@ -64,44 +89,45 @@ rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(InputIt from, InputIt to
     insert(*from);
   }
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >&
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::operator=(const MapBase& rhs)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >&
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::operator=(const MapBase& rhs)
 {
   MapBase temp = rhs;
   swap(temp);
   return *this;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >&
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::operator=(MapBase&& rhs)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >&
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::operator=(MapBase&& rhs)
     noexcept(noexcept(swap(std::declval< MapBase& >())))
 {
   MapBase temp = std::move(rhs);
   swap(temp);
   return *this;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >&
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::operator=(std::initializer_list< value_type > init)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >&
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::operator=(std::initializer_list< value_type > init)
 {
   MapBase temp = init;
   swap(temp);
   return *this;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::~MapBase()
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::~MapBase()
 {
   clear();
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::swap(MapBase& rhs)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::swap(MapBase& rhs)
     noexcept(is_nothrow_swappable_v< value_compare >)
 {
   std::swap(comp_, rhs.comp_);
   std::swap(cached_begin_, rhs.cached_begin_);
   std::swap(cached_rbegin_, rhs.cached_rbegin_);
   std::swap(size_, rhs.size_);
+  std::swap(alloc_, rhs.alloc_);
   std::swap(fake_children_[0], rhs.fake_children_[0]);
   if (size_ == 0)
   {
@@ -120,28 +146,115 @@ void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::swap(MapBase& rhs)
     rhs.fake_children_[0]->parent = rhs.fake_root();
   }
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::clear() noexcept
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::clear() noexcept
 {
-  iterator i = begin();
-  while (!i.node_->isfake())
+  if (!is_pool_allocator_v< node_allocator > || !std::is_trivially_destructible< real_value_type >::value)
   {
-    if ((i.node_->isleaf()) || (i.pointed_ == i.node_->size()))
-    {
-      node_type* to_delete = i.node_;
-      i.move_up();
-      delete to_delete;
-    }
-    else
+    iterator i = begin();
+    while (!i.node_->isfake())
     {
-      i.pointed_++;
-      for (; !i.node_->isleaf(); i.node_ = i.node_->children[i.pointed_], i.pointed_ = 0)
-      {}
+      if ((i.node_->isleaf()) || (i.pointed_ == i.node_->size()))
+      {
+        node_type* to_delete = i.node_;
+        i.move_up();
+        destroy_node(to_delete);
+      }
+      else
+      {
+        i.pointed_++;
+        for (; !i.node_->isleaf(); i.node_ = i.node_->children[i.pointed_], i.pointed_ = 0)
+        {}
+      }
     }
   }
+  release_nodes(is_pool_allocator< node_allocator >{});
   fake_children_[0] = nullptr;
   size_ = 0;
   cached_rbegin_ = cached_begin_ = fake_root();
 }
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::node_type*
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::create_node()
+{
+  return new(node_allocator_traits::allocate(alloc_, 1)) node_type;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::destroy_node(node_type* node) noexcept
+{
+  if (node != nullptr)
+  {
+    node->~node_type();
+    node_allocator_traits::deallocate(alloc_, node, 1);
+  }
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::release_nodes(std::true_type) noexcept
+{
+  alloc_.release();
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::release_nodes(std::false_type) noexcept
+{}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::reserve_nodes(size_type count, std::true_type)
+{
+  alloc_.reserve(count);
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::reserve_nodes(size_type, std::false_type) noexcept
+{}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::count_nodes(const node_type* root) noexcept
+{
+  size_type result = 1;
+  if (!root->isleaf())
+  {
+    for (node_size_type i = 0; i <= root->size(); i++)
+    {
+      result += count_nodes(root->children[i]);
+    }
+  }
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::node_type*
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::copy_subtree(const node_type* src, node_type* parent)
+{
+  node_type* result = create_node();
+  result->parent = parent;
+  result->children[0] = nullptr;
+  try
+  {
+    for (node_size_type i = 0; i < src->size(); i++)
+    {
+      result->emplace_back(src->operator[](i));
+    }
+    if (!src->isleaf())
+    {
+      for (node_size_type i = 0; i <= src->size(); i++)
+      {
+        result->children[i] = copy_subtree(src->children[i], result);
+      }
+    }
+    result->recount_subtree();
+  }
+  catch (...)
+  {
+    destroy_subtree(result);
+    throw;
+  }
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::destroy_subtree(node_type* root) noexcept
+{
+  for (node_size_type i = 0; (i <= root->size()) && (root->children[i] != nullptr); i++)
+  {
+    destroy_subtree(root->children[i]);
+  }
+  destroy_node(root);
+}
 
 #endif
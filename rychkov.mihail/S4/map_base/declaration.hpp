@@ -4,6 +4,7 @@
 #include <utility>
 #include <type_traits>
 #include <memory>
+#include <pool_allocator.hpp>
 #include "node.hpp"
 #include "iterator.hpp"
 
@@ -37,13 +38,15 @@ namespace rychkov
               Exclude >::value... > && is_transparent_v< C >, R >;
   }
 
-  template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+  template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti,
+      class A = PoolAllocator< std::conditional_t< IsSet, K, std::pair< const K, T > > > >
   class MapBase
   {
   public:
     using key_type = K;
     using mapped_type = T;
     using key_compare = C;
+    using allocator_type = A;
   private:
     using real_value_type = std::conditional_t< IsSet, key_type, std::pair< key_type, mapped_type > >;
   public:
@@ -67,7 +70,7 @@ namespace rychkov
 
       key_compare comp;
       template< bool IsSet2 = IsSet >
-      bool operator()(const std::enable_if_t< IsSet2 && IsSet, value_type >& lhs, const value_type& rhs) const
+      bool operator()(const std::enable_if_t< !IsSet2 && !IsSet, value_type >& lhs, const value_type& rhs) const
       {
         return comp(lhs.first, rhs.first);
       }
@@ -116,6 +119,11 @@ namespace rychkov
     std::pair< const_iterator, const_iterator > equal_range(const key_type& key) const;
     size_type count(const key_type& key) const;
 
+    size_type rank(const key_type& key) const;
+    iterator nth(size_type pos);
+    const_iterator nth(size_type pos) const;
+    size_type distance(const_iterator from, const_iterator to) const noexcept;
+
   private:
     template< class R, class K1 >
     using transparent_compare_key_t = details::transparent_compare_key_t< R, K1, C, iterator, const_iterator >;
@@ -213,24 +221,42 @@ namespace rychkov
   private:
     static constexpr size_t node_capacity = N;
     static constexpr size_t node_middle = (node_capacity + 1) / 2;
+    static constexpr size_t linear_search_limit = std::is_arithmetic< key_type >::value ? 8 : node_capacity + 1;
     using node_type = MapBaseNode< real_value_type, node_capacity >;
     using node_size_type = typename node_type::size_type;
+    using node_allocator = typename std::allocator_traits< A >::template rebind_alloc< node_type >;
+    using node_allocator_traits = std::allocator_traits< node_allocator >;
 
     value_compare comp_;
     node_type* cached_begin_;
     node_type* cached_rbegin_;
     size_t size_;
+    node_allocator alloc_;
 
     node_type*const fake_parent_ = nullptr;
     node_type* fake_children_[node_capacity + 1];
     const node_size_type fake_size_;
 
     node_type* fake_root() const noexcept;
+    node_type* create_node();
+    void destroy_node(node_type* node) noexcept;
+    void release_nodes(std::true_type) noexcept;
+    void release_nodes(std::false_type) noexcept;
+    void reserve_nodes(size_type count, std::true_type);
+    void reserve_nodes(size_type count, std::false_type) noexcept;
+    static size_type count_nodes(const node_type* root) noexcept;
+    node_type* copy_subtree(const node_type* src, node_type* parent);
+    void destroy_subtree(node_type* root) noexcept;
     void devide(node_type& left, node_type& right, node_size_type ins_point, node_type& to_insert);
-    static void correct_emplace_result(node_type& left, node_type& right,
+    static bool correct_emplace_result(node_type& left, node_type& right,
         node_size_type ins_point, const_iterator& hint);
     static void correct_erase_result(const_iterator to, const_iterator from, iterator& result, bool will_be_replaced);
 
+    template< class K1 >
+    node_size_type node_lower_bound(node_type* node, const K1& key) const;
+    template< class K1 >
+    node_size_type node_upper_bound(node_type* node, const K1& key) const;
+    size_type position(const_iterator pos) const noexcept;
     template< class K1 >
     std::pair< const_iterator, const_iterator > lower_bound_impl(const K1& key) const;
     template< class K1 >
@@ -7,10 +7,10 @@
 #include <limits>
 #include <type_traits>
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class... Args >
-std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, bool >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::emplace_hint_impl(std::pair< const_iterator, bool > hint_pair,
+std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator, bool >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::emplace_hint_impl(std::pair< const_iterator, bool > hint_pair,
       Args&&... args)
 {
   static_assert(std::is_nothrow_move_constructible< real_value_type >::value, "move construct need to be nothrow");
@@ -23,9 +23,10 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, bo
 
   if (size_ == 0)
   {
-    node_type* root = new node_type;
+    node_type* root = create_node();
     fake_children_[0] = root;
     root->emplace_back(std::forward< Args >(args)...);
+    root->recount_subtree();
     root->parent = fake_root();
     cached_begin_ = root;
     cached_rbegin_ = root;
@@ -35,6 +36,7 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, bo
   if (!hint.node_->full())
   {
     hint.node_->emplace(hint.pointed_, std::forward< Args >(args)...);
+    hint.node_->shift_subtree_sizes(1);
     size_++;
     return {{hint.node_, hint.pointed_}, true};
   }
@@ -45,23 +47,27 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, bo
   constexpr size_t max_tree_depth = std::numeric_limits< size_t >::digits + 1;
   struct MemSaver
   {
+    MapBase& owner;
     node_type* data[max_tree_depth];
     node_size_type ins_points[max_tree_depth];
     size_t size = 0;
+    explicit MemSaver(MapBase& map):
+      owner(map)
+    {}
     ~MemSaver()
     {
       while (size > 0)
       {
-        delete data[--size];
+        owner.destroy_node(data[--size]);
       }
     }
     void push(node_size_type pointed)
     {
-      data[size] = new node_type;
+      data[size] = owner.create_node();
       ins_points[size++] = pointed;
     }
   };
-  MemSaver storage;
+  MemSaver storage{*this};
   const_iterator temp = hint;
   for (; temp.node_->full(); temp.move_up())
   {
@@ -73,10 +79,16 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, bo
   }
 
   node_type* caret = hint.node_;
+  bool rising = true;
   for (size_type i = 0; caret->full(); caret = caret->parent, i++)
   {
     devide(*caret, *storage.data[i], storage.ins_points[i], to_insert);
-    correct_emplace_result(*caret, *storage.data[i], storage.ins_points[i], hint);
+    caret->recount_subtree();
+    storage.data[i]->recount_subtree();
+    if (rising)
+    {
+      rising = correct_emplace_result(*caret, *storage.data[i], storage.ins_points[i], hint);
+    }
     if (cached_rbegin_ == caret)
     {
       cached_rbegin_ = storage.data[i];
@@ -94,7 +106,11 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, bo
     root->children[0] = to_insert.children[0];
     root->children[1] = to_insert.children[1];
     to_insert.pop_back();
-    correct_emplace_result(*root, *storage.data[storage.size - 1], 0, hint);
+    root->recount_subtree();
+    if (rising)
+    {
+      hint = {root, 0};
+    }
     storage.data[storage.size - 1] = nullptr;
   }
   else
@@ -102,7 +118,8 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, bo
     caret->emplace(temp.pointed_, std::move(to_insert[0]));
     caret->children[temp.pointed_] = to_insert.children[0];
     caret->children[temp.pointed_ + 1] = to_insert.children[1];
-    if (hint.pointed_ > node_middle)
+    caret->shift_subtree_sizes(1);
+    if (rising)
     {
       hint = {caret, temp.pointed_};
     }
@@ -111,8 +128,8 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, bo
   size_++;
   return {{hint.node_, hint.pointed_}, true};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::devide(node_type& left, node_type& right,
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::devide(node_type& left, node_type& right,
       node_size_type ins_point, node_type& to_insert)
 {
   if (ins_point <= node_middle)
@@ -181,23 +198,21 @@ void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::devide(node_type& left, nod
   to_insert.children[0] = &left;
   to_insert.children[1] = &right;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::correct_emplace_result(node_type& left, node_type& right,
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::correct_emplace_result(node_type& left, node_type& right,
     node_size_type ins_point, const_iterator& hint)
 {
-  if ((hint.pointed_ > node_middle) && (ins_point != node_middle))
+  if (ins_point < node_middle)
   {
-    if (ins_point < node_middle)
-    {
-      hint.pointed_ = ins_point;
-      hint.node_ = &left;
-    }
-    else
-    {
-      hint.pointed_ = hint.pointed_ - node_middle - 1;
-      hint.node_ = &right;
-    }
+    hint = {&left, ins_point};
+    return false;
+  }
+  if (ins_point > node_middle)
+  {
+    hint = {&right, static_cast< node_size_type >(ins_point - node_middle - 1)};
+    return false;
   }
+  return true;
 }
 
 #endif
@@ -6,9 +6,9 @@
 #include <iterator>
 #include <type_traits.hpp>
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::erase(const_iterator pos)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::erase(const_iterator pos)
 {
   static_assert(std::is_nothrow_move_constructible< real_value_type >::value, "move construct need to be nothrow");
 
@@ -24,6 +24,7 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
   if (pos.node_->size() > 1)
   {
     pos.node_->erase(pos.pointed_);
+    pos.node_->shift_subtree_sizes(-1);
     correct_erase_result(pos, pos, result, false);
     return result;
   }
@@ -36,12 +37,12 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
         fake_children_[0] = nullptr;
         cached_begin_ = fake_root();
         cached_rbegin_ = cached_begin_;
-        delete pos.node_;
+        destroy_node(pos.node_);
         return result;
       }
       fake_children_[0] = pos.node_->children[0];
       fake_children_[0]->parent = fake_root();
-      delete pos.node_;
+      destroy_node(pos.node_);
       return result;
     }
     pos.node_->pop_back();
@@ -67,6 +68,9 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
           erased.node_->children[0]->parent = erased.node_;
         }
         src->pop_back();
+        erased.node_->recount_subtree();
+        src->recount_subtree();
+        parent.node_->shift_subtree_sizes(-1);
         return result;
       }
       else
@@ -88,8 +92,9 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
         {
           cached_begin_ = erased.node_;
         }
-        delete src;
+        destroy_node(src);
         parent.node_->children[parent.pointed_] = erased.node_;
+        erased.node_->recount_subtree();
         pos = parent;
       }
     }
@@ -110,6 +115,9 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
         }
         src->children[0] = src->children[1];
         src->erase(0);
+        erased.node_->recount_subtree();
+        src->recount_subtree();
+        pos.node_->shift_subtree_sizes(-1);
         return result;
       }
       else
@@ -127,25 +135,27 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
           erased.node_->children[2]->parent = erased.node_;
         }
         src->pop_back();
-        if (src == cached_begin_)
+        if (src == cached_rbegin_)
         {
-          cached_begin_ = erased.node_;
+          cached_rbegin_ = erased.node_;
         }
-        delete src;
+        destroy_node(src);
         parent.node_->children[parent.pointed_] = erased.node_;
+        erased.node_->recount_subtree();
       }
     }
     if (parent.node_->size() > 1)
     {
       parent.node_->erase(pos.pointed_);
+      parent.node_->shift_subtree_sizes(-1);
       correct_erase_result(pos, pos, result, false);
       return result;
     }
   }
   return result;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::correct_erase_result(const_iterator to,
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::correct_erase_result(const_iterator to,
     const_iterator from, iterator& result, bool will_be_replaced)
 {
   if ((from.node_ != result.node_) || (result.pointed_ < from.pointed_))
@@ -163,9 +173,9 @@ void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::correct_erase_result(const_
   }
 }
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::size_type
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::erase(const key_type& key)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::erase(const key_type& key)
 {
   size_type result = 0;
   const_iterator iter = lower_bound(key);
@@ -173,11 +183,11 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::size_type
   {}
   return result;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::size_type, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::erase(const K1& key)
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::size_type, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::erase(const K1& key)
 {
   size_type result = 0;
   const_iterator iter = lower_bound(key);
@@ -185,9 +195,9 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key
   {}
   return result;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::erase(const_iterator from, const_iterator to)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::erase(const_iterator from, const_iterator to)
 {
 
   for (size_type len = std::distance(from, to); len > 0; len--)
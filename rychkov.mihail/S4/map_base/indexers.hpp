@@ -5,11 +5,11 @@
 
 #include <utility>
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< bool IsSet2, bool IsMulti2 >
 std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
-      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::mapped_type& >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::at(const key_type& key)
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::mapped_type& >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::at(const key_type& key)
 {
   iterator temp = find(key);
   if (temp == end())
@@ -18,11 +18,11 @@ std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
   }
   return temp->second;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< bool IsSet2, bool IsMulti2 >
 std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
-      const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::mapped_type& >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::at(const key_type& key) const
+      const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::mapped_type& >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::at(const key_type& key) const
 {
   const_iterator temp = this->find(key);
   if (temp == this->end())
@@ -31,12 +31,12 @@ std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
   }
   return temp->second;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1, bool IsSet2, bool IsMulti2 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
     < std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
-      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::mapped_type& >, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::at(const K1& key)
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::mapped_type& >, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::at(const K1& key)
 {
   iterator temp = this->find(key);
   if (temp == this->end())
@@ -45,12 +45,12 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key
   }
   return temp->second;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1, bool IsSet2, bool IsMulti2 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
     < std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
-      const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::mapped_type& >, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::at(const K1& key) const
+      const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::mapped_type& >, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::at(const K1& key) const
 {
   const_iterator temp = this->find(key);
   if (temp == this->end())
@@ -59,28 +59,28 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key
   }
   return temp->second;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< bool IsSet2, bool IsMulti2 >
 std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
-      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::mapped_type& >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::operator[](const key_type& key)
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::mapped_type& >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::operator[](const key_type& key)
 {
   return this->try_emplace(key).first->second;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< bool IsSet2, bool IsMulti2 >
 std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
-      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::mapped_type& >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::operator[](key_type&& key)
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::mapped_type& >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::operator[](key_type&& key)
 {
   return this->try_emplace(std::move(key)).first->second;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1, bool IsSet2, bool IsMulti2 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
     < std::enable_if_t< !IsSet && !IsSet2 && !IsMulti && !IsMulti2,
-      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::mapped_type& >, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::operator[](K1&& key)
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::mapped_type& >, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::operator[](K1&& key)
 {
   return this->try_emplace(std::forward< K1 >(key)).first->second;
 }
@@ -85,7 +85,7 @@ namespace rychkov
       return reinterpret_cast< value_type* >(std::addressof(node_->operator[](pointed_)));
     }
   private:
-    template< class K, class M, class C, size_t N1, bool IsSet, bool IsMulti >
+    template< class K, class M, class C, size_t N1, bool IsSet, bool IsMulti, class A >
     friend class MapBase;
     friend class MapBaseIterator< Value, N, RealValue, true, isReversed >;
 
@@ -131,6 +131,10 @@ void rychkov::MapBaseIterator< Value, N, RealValue, isConst, isReversed >::shift
         break;
       }
     }
+    if (!node_->isfake())
+    {
+      pointed_--;
+    }
   }
 }
 template< class Value, size_t N, class RealValue, bool isConst, bool isReversed >
@@ -8,6 +8,17 @@
 
 namespace rychkov
 {
+  constexpr size_t cache_line_size = 64;
+
+  template< class Value, size_t CacheLines = 2 >
+  struct cache_fit_capacity
+  {
+    static constexpr size_t fit = CacheLines * cache_line_size / sizeof(Value);
+    static constexpr size_t value = (fit > 2) ? fit : 2;
+  };
+  template< class Value, size_t CacheLines = 2 >
+  constexpr size_t cache_fit_capacity_v = cache_fit_capacity< Value, CacheLines >::value;
+
   template< class Value, size_t N >
   class MapBaseNode
   {
@@ -34,7 +45,7 @@ namespace rychkov
     }
     const value_type& operator[](size_type i) const
     {
-      return *(reinterpret_cast< value_type* >(data_) + i);
+      return *(reinterpret_cast< const value_type* >(data_) + i);
     }
     bool empty() const noexcept
     {
@@ -104,9 +115,33 @@ namespace rychkov
     {
       operator[](--size_).~value_type();
     }
+    size_t subtree_size() const noexcept
+    {
+      return subtree_size_;
+    }
+    void recount_subtree() noexcept
+    {
+      subtree_size_ = size_;
+      if (!isleaf())
+      {
+        for (size_type i = 0; i <= size_; i++)
+        {
+          subtree_size_ += children[i]->subtree_size_;
+        }
+      }
+    }
+    void shift_subtree_sizes(ptrdiff_t diff) noexcept
+    {
+      for (MapBaseNode* node = this; !node->isfake(); node = node->parent)
+      {
+        node->subtree_size_ += diff;
+      }
+    }
   private:
     size_type size_ = 0;
     alignas(value_type) unsigned char data_[node_capacity * sizeof(value_type)];
+    // the fake root only mirrors parent, children and size_, so this stays after them
+    size_t subtree_size_ = 0;
   };
 }
 
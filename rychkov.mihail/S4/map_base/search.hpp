@@ -5,284 +5,402 @@
 
 #include <iterator>
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< bool IsSet2 >
-bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::compare_with_key
+bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::compare_with_key
     (std::enable_if_t< !IsSet && !IsSet2, const value_type >& lhs, const key_type& rhs) const
 {
   return comp_.comp(lhs.first, rhs);
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< bool IsSet2 >
-bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::compare_with_key
+bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::compare_with_key
     (const key_type& lhs, std::enable_if_t< !IsSet && !IsSet2, const value_type >& rhs) const
 {
   return comp_.comp(lhs, rhs.first);
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< bool IsSet2 >
-std::enable_if_t< IsSet && IsSet2, bool > rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::compare_with_key
+std::enable_if_t< IsSet && IsSet2, bool > rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::compare_with_key
     (const key_type& lhs, const key_type& rhs) const
 {
   return comp_(lhs, rhs);
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< bool IsSet2 >
-std::enable_if_t< !IsSet && !IsSet2, bool > rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::compare_with_key
+std::enable_if_t< !IsSet && !IsSet2, bool > rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::compare_with_key
     (const key_type& lhs, const key_type& rhs) const
 {
   return comp_.comp(lhs, rhs);
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class V >
-const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::key_type&
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::get_key(const V& value)
+const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::key_type&
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::get_key(const V& value)
 {
   return value.first;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::key_type&
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::get_key(const key_type& key)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::key_type&
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::get_key(const key_type& key)
 {
   return key;
 }
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator,
-      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::lower_bound_impl(const K1& key) const
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::node_lower_bound(node_type* node, const K1& key) const
+{
+  node_size_type len = node->size();
+  if (node_capacity < linear_search_limit)
+  {
+    node_size_type i = 0;
+    for (; (i < len) && compare_with_key(*const_iterator{node, i}, key); i++)
+    {}
+    return i;
+  }
+  if (len == 0)
+  {
+    return 0;
+  }
+  node_size_type first = 0;
+  while (len > 1)
+  {
+    const node_size_type half = len / 2;
+    const_iterator middle = {node, static_cast< node_size_type >(first + half)};
+    first = compare_with_key(*middle, key) ? first + half : first;
+    len -= half;
+  }
+  return compare_with_key(*const_iterator{node, first}, key) ? first + 1 : first;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::node_upper_bound(node_type* node, const K1& key) const
+{
+  node_size_type len = node->size();
+  if (node_capacity < linear_search_limit)
+  {
+    node_size_type i = 0;
+    for (; (i < len) && !compare_with_key(key, *const_iterator{node, i}); i++)
+    {}
+    return i;
+  }
+  if (len == 0)
+  {
+    return 0;
+  }
+  node_size_type first = 0;
+  while (len > 1)
+  {
+    const node_size_type half = len / 2;
+    const_iterator middle = {node, static_cast< node_size_type >(first + half)};
+    first = compare_with_key(key, *middle) ? first : first + half;
+    len -= half;
+  }
+  return compare_with_key(key, *const_iterator{node, first}) ? first : first + 1;
+}
+
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+template< class K1 >
+std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator,
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::lower_bound_impl(const K1& key) const
 {
   if (size_ == 0)
   {
     return {end(), end()};
   }
-  const_iterator left = {fake_children_[0], 0}, right = end();
+  node_type* node = fake_children_[0];
+  const_iterator right = end();
   while (true)
   {
-    if (compare_with_key(key, *left))
+    node_size_type i = node_lower_bound(node, key);
+    if (i < node->size())
     {
-      right = left;
-      if (left.node_->isleaf())
+      const_iterator found = {node, i};
+      if (!IsMulti && !compare_with_key(key, *found))
       {
-        return {left, left};
+        return {found, found};
       }
-      left = {left.node_->children[left.pointed_], 0};
+      right = found;
     }
-    else if (!compare_with_key(*left, key))
+    if (node->isleaf())
     {
-      if (IsMulti)
-      {
-        right = left;
-        if (left.node_->isleaf())
-        {
-          return {left, left};
-        }
-        left = {left.node_->children[left.pointed_], 0};
-        continue;
-      }
-      return {left, left};
-    }
-    else
-    {
-      left.pointed_++;
-      if (left.pointed_ >= left.node_->size())
-      {
-        if (left.node_->isleaf())
-        {
-          return {left, right};
-        }
-        left = {left.node_->children[left.pointed_], 0};
-      }
+      return {{node, i}, right};
     }
+    node = node->children[i];
   }
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound_impl(const K1& key) const
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::upper_bound_impl(const K1& key) const
 {
   if (size_ == 0)
   {
     return end();
   }
-  const_iterator left = {fake_children_[0], 0}, right = end();
+  node_type* node = fake_children_[0];
+  const_iterator right = end();
   while (true)
   {
-    node_size_type i = 0;
-    while (i < left.node_->size())
+    node_size_type i = node_upper_bound(node, key);
+    if (i < node->size())
     {
-      if (compare_with_key(key, left.node_->operator[](i)))
-      {
-        right = {left.node_, i};
-        if (left.node_->isleaf())
-        {
-          return right;
-        }
-        left = {left.node_->children[i], 0};
-        i = 0;
-        continue;
-      }
-      i++;
+      right = {node, i};
     }
-    if (left.node_->isleaf())
+    if (node->isleaf())
     {
       return right;
     }
-    left = {left.node_->children[i], 0};
+    node = node->children[i];
   }
 }
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::lower_bound(const key_type& key)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::lower_bound(const key_type& key)
 {
   const_iterator temp = lower_bound_impl(key).second;
   return {temp.node_, temp.pointed_};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::lower_bound(const key_type& key) const
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::lower_bound(const key_type& key) const
 {
   return lower_bound_impl(key).second;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound(const key_type& key)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::upper_bound(const key_type& key)
 {
   const_iterator temp = upper_bound_impl(key);
   return {temp.node_, temp.pointed_};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound(const key_type& key) const
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::upper_bound(const key_type& key) const
 {
   return upper_bound_impl(key);
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::find(const key_type& key)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::find(const key_type& key)
 {
   const_iterator temp = lower_bound(key);
   return ((temp != end()) && !compare_with_key(key, *temp)) ? iterator{temp.node_, temp.pointed_} : end();
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::find(const key_type& key) const
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::find(const key_type& key) const
 {
   const_iterator temp = lower_bound(key);
   return ((temp != end()) && !compare_with_key(key, *temp)) ? temp : end();
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::contains(const key_type& key) const
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::contains(const key_type& key) const
 {
   return find(key) != end();
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator,
-      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::equal_range(const key_type& key)
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator,
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::equal_range(const key_type& key)
 {
   return {lower_bound(key), upper_bound(key)};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator,
-      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::equal_range(const key_type& key) const
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator,
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::equal_range(const key_type& key) const
 {
   return {lower_bound(key), upper_bound(key)};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::size_type
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::count(const key_type& key) const
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::count(const key_type& key) const
 {
-  return std::distance(lower_bound(key), upper_bound(key));
+  return distance(lower_bound(key), upper_bound(key));
 }
 
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::lower_bound(const K1& key)
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::lower_bound(const K1& key)
 {
   const_iterator temp = lower_bound_impl(key).second;
   return {temp.node_, temp.pointed_};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::lower_bound(const K1& key) const
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::lower_bound(const K1& key) const
 {
   return lower_bound_impl(key).second;
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound(const K1& key)
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::upper_bound(const K1& key)
 {
   const_iterator temp = upper_bound_impl(key);
   return {temp.node_, temp.pointed_};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::upper_bound(const K1& key) const
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::upper_bound(const K1& key) const
 {
   return upper_bound_impl(key);
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::find(const K1& key)
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::find(const K1& key)
 {
   const_iterator temp = lower_bound(key);
   return ((temp != end()) && !compare_with_key(key, *temp)) ? iterator{temp.node_, temp.pointed_} : end();
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::find(const K1& key) const
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::find(const K1& key) const
 {
   const_iterator temp = lower_bound(key);
   return ((temp != end()) && !compare_with_key(key, *temp)) ? temp : end();
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t< bool, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::contains(const K1& key) const
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t< bool, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::contains(const K1& key) const
 {
   return find(key) != end();
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator,
-        typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::iterator >, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::equal_range(const K1& key)
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator,
+        typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator >, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::equal_range(const K1& key)
 {
   return {lower_bound(key), upper_bound(key)};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator,
-        typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator >, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::equal_range(const K1& key) const
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator,
+        typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator >, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::equal_range(const K1& key) const
 {
   return {lower_bound(key), upper_bound(key)};
 }
-template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
 template< class K1 >
-typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::transparent_compare_key_t
-    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::size_type, K1 >
-    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::count(const K1& key) const
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::transparent_compare_key_t
+    < typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::size_type, K1 >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::count(const K1& key) const
+{
+  return distance(lower_bound(key), upper_bound(key));
+}
+
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::rank(const key_type& key) const
+{
+  if (size_ == 0)
+  {
+    return 0;
+  }
+  size_type result = 0;
+  node_type* node = fake_children_[0];
+  while (true)
+  {
+    node_size_type i = node_lower_bound(node, key);
+    result += i;
+    if (node->isleaf())
+    {
+      return result;
+    }
+    for (node_size_type j = 0; j < i; j++)
+    {
+      result += node->children[j]->subtree_size();
+    }
+    node = node->children[i];
+  }
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::nth(size_type pos)
 {
-  return std::distance(lower_bound(key), upper_bound(key));
+  const_iterator temp = static_cast< const MapBase* >(this)->nth(pos);
+  return {temp.node_, temp.pointed_};
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::const_iterator
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::nth(size_type pos) const
+{
+  if (pos >= size_)
+  {
+    return end();
+  }
+  node_type* node = fake_children_[0];
+  while (!node->isleaf())
+  {
+    node_size_type i = 0;
+    for (; pos >= node->children[i]->subtree_size(); i++)
+    {
+      pos -= node->children[i]->subtree_size();
+      if (pos == 0)
+      {
+        return {node, i};
+      }
+      pos--;
+    }
+    node = node->children[i];
+  }
+  return {node, static_cast< node_size_type >(pos)};
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::distance(const_iterator from, const_iterator to) const noexcept
+{
+  return position(to) - position(from);
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti, class A >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti, A >::position(const_iterator pos) const noexcept
+{
+  if (pos.node_->isfake())
+  {
+    return size_;
+  }
+  node_type* node = pos.node_;
+  size_type result = pos.pointed_;
+  size_type children_before = pos.pointed_ + 1;
+  while (!node->isfake())
+  {
+    if (!node->isleaf())
+    {
+      for (size_type i = 0; i < children_before; i++)
+      {
+        result += node->children[i]->subtree_size();
+      }
+    }
+    node_type* prev = node;
+    node = node->parent;
+    for (children_before = 0; node->children[children_before] != prev; children_before++)
+    {}
+    result += children_before;
+  }
+  return result;
 }
 
 #endif
@@ -0,0 +1,353 @@
+#ifndef PERSISTENT_MAP_HPP
+#define PERSISTENT_MAP_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace rychkov
+{
+  // Path-copying AVL map. Readers take an immutable Snapshot and never block: a snapshot owns its root and
+  // every node below it, so it stays valid while writers publish new roots. Writers are serialized.
+  template< class K, class T, class C = std::less<> >
+  class PersistentMap
+  {
+  public:
+    using key_type = K;
+    using mapped_type = T;
+    using key_compare = C;
+    using value_type = std::pair< const key_type, mapped_type >;
+    using size_type = size_t;
+  private:
+    struct Node;
+    using node_ptr = std::shared_ptr< const Node >;
+    using value_ptr = std::shared_ptr< const value_type >;
+
+    struct Node
+    {
+      value_ptr value;
+      node_ptr left;
+      node_ptr right;
+      size_type size;
+      int height;
+    };
+  public:
+    class const_iterator: public std::iterator< std::forward_iterator_tag, const value_type >
+    {
+    public:
+      // an AVL tree of this height needs more than 10^13 nodes
+      static constexpr size_t max_height = 64;
+
+      const_iterator() noexcept = default;
+      const_iterator(const const_iterator& rhs) noexcept:
+        depth_(rhs.depth_)
+      {
+        std::copy(rhs.path_, rhs.path_ + depth_, path_);
+      }
+      const_iterator& operator=(const const_iterator& rhs) noexcept
+      {
+        depth_ = rhs.depth_;
+        std::copy(rhs.path_, rhs.path_ + depth_, path_);
+        return *this;
+      }
+      const value_type& operator*() const noexcept
+      {
+        return *path_[depth_ - 1]->value;
+      }
+      const value_type* operator->() const noexcept
+      {
+        return path_[depth_ - 1]->value.get();
+      }
+      const_iterator& operator++() noexcept
+      {
+        const Node* node = path_[--depth_]->right.get();
+        descend(node);
+        return *this;
+      }
+      const_iterator operator++(int) noexcept
+      {
+        const_iterator temp = *this;
+        ++(*this);
+        return temp;
+      }
+      bool operator==(const const_iterator& rhs) const noexcept
+      {
+        if ((depth_ == 0) || (rhs.depth_ == 0))
+        {
+          return depth_ == rhs.depth_;
+        }
+        return path_[depth_ - 1] == rhs.path_[rhs.depth_ - 1];
+      }
+      bool operator!=(const const_iterator& rhs) const noexcept
+      {
+        return !(*this == rhs);
+      }
+    private:
+      const Node* path_[max_height];
+      size_t depth_ = 0;
+
+      void descend(const Node* node) noexcept
+      {
+        for (; node != nullptr; node = node->left.get())
+        {
+          path_[depth_++] = node;
+        }
+      }
+
+      friend class PersistentMap;
+      friend class Snapshot;
+    };
+    using iterator = const_iterator;
+
+    class Snapshot
+    {
+    public:
+      Snapshot() = default;
+
+      bool empty() const noexcept
+      {
+        return root_ == nullptr;
+      }
+      size_type size() const noexcept
+      {
+        return node_size(root_.get());
+      }
+      const_iterator begin() const noexcept
+      {
+        const_iterator result;
+        result.descend(root_.get());
+        return result;
+      }
+      const_iterator end() const noexcept
+      {
+        return {};
+      }
+      const_iterator find(const key_type& key) const
+      {
+        const_iterator result;
+        const Node* node = root_.get();
+        while (node != nullptr)
+        {
+          if (comp_(key, node->value->first))
+          {
+            result.path_[result.depth_++] = node;
+            node = node->left.get();
+          }
+          else if (comp_(node->value->first, key))
+          {
+            node = node->right.get();
+          }
+          else
+          {
+            result.path_[result.depth_++] = node;
+            return result;
+          }
+        }
+        return end();
+      }
+      bool contains(const key_type& key) const
+      {
+        return find(key) != end();
+      }
+      const mapped_type& at(const key_type& key) const
+      {
+        const_iterator result = find(key);
+        if (result == end())
+        {
+          throw std::out_of_range("key not found");
+        }
+        return result->second;
+      }
+    private:
+      node_ptr root_;
+      key_compare comp_;
+
+      Snapshot(node_ptr root, const key_compare& comp):
+        root_(std::move(root)),
+        comp_(comp)
+      {}
+
+      friend class PersistentMap;
+    };
+
+    PersistentMap() = default;
+    explicit PersistentMap(const key_compare& comp):
+      comp_(comp)
+    {}
+    PersistentMap(const PersistentMap&) = delete;
+    PersistentMap& operator=(const PersistentMap&) = delete;
+
+    Snapshot snapshot() const
+    {
+      return {std::atomic_load(&root_), comp_};
+    }
+    bool empty() const
+    {
+      return snapshot().empty();
+    }
+    size_type size() const
+    {
+      return snapshot().size();
+    }
+
+    template< class... Args >
+    bool try_emplace(const key_type& key, Args&&... args)
+    {
+      std::lock_guard< std::mutex > lock(writer_);
+      bool inserted = false;
+      node_ptr root = insert_impl(std::atomic_load(&root_), key, false, inserted, std::forward< Args >(args)...);
+      if (inserted)
+      {
+        std::atomic_store(&root_, std::move(root));
+      }
+      return inserted;
+    }
+    template< class M >
+    bool insert_or_assign(const key_type& key, M&& obj)
+    {
+      std::lock_guard< std::mutex > lock(writer_);
+      bool inserted = false;
+      node_ptr root = insert_impl(std::atomic_load(&root_), key, true, inserted, std::forward< M >(obj));
+      std::atomic_store(&root_, std::move(root));
+      return inserted;
+    }
+    size_type erase(const key_type& key)
+    {
+      std::lock_guard< std::mutex > lock(writer_);
+      bool erased = false;
+      node_ptr root = erase_impl(std::atomic_load(&root_), key, erased);
+      if (erased)
+      {
+        std::atomic_store(&root_, std::move(root));
+      }
+      return erased;
+    }
+    void clear()
+    {
+      std::lock_guard< std::mutex > lock(writer_);
+      std::atomic_store(&root_, node_ptr{});
+    }
+  private:
+    node_ptr root_;
+    key_compare comp_;
+    std::mutex writer_;
+
+    static size_type node_size(const Node* node) noexcept
+    {
+      return (node == nullptr) ? 0 : node->size;
+    }
+    static int node_height(const Node* node) noexcept
+    {
+      return (node == nullptr) ? 0 : node->height;
+    }
+    static node_ptr make_node(value_ptr value, node_ptr left, node_ptr right)
+    {
+      size_type size = node_size(left.get()) + node_size(right.get()) + 1;
+      int height = std::max(node_height(left.get()), node_height(right.get())) + 1;
+      return std::make_shared< Node >(Node{std::move(value), std::move(left), std::move(right), size, height});
+    }
+    static node_ptr balance(value_ptr value, node_ptr left, node_ptr right)
+    {
+      int left_height = node_height(left.get());
+      int right_height = node_height(right.get());
+      if (left_height > right_height + 1)
+      {
+        if (node_height(left->left.get()) >= node_height(left->right.get()))
+        {
+          return make_node(left->value, left->left, make_node(std::move(value), left->right, std::move(right)));
+        }
+        const Node& pivot = *left->right;
+        return make_node(pivot.value, make_node(left->value, left->left, pivot.left),
+              make_node(std::move(value), pivot.right, std::move(right)));
+      }
+      if (right_height > left_height + 1)
+      {
+        if (node_height(right->right.get()) >= node_height(right->left.get()))
+        {
+          return make_node(right->value, make_node(std::move(value), std::move(left), right->left), right->right);
+        }
+        const Node& pivot = *right->left;
+        return make_node(pivot.value, make_node(std::move(value), std::move(left), pivot.left),
+              make_node(right->value, pivot.right, right->right));
+      }
+      return make_node(std::move(value), std::move(left), std::move(right));
+    }
+    template< class... Args >
+    node_ptr insert_impl(const node_ptr& node, const key_type& key, bool assign, bool& inserted, Args&&... args)
+    {
+      if (node == nullptr)
+      {
+        inserted = true;
+        return make_node(std::make_shared< value_type >(std::piecewise_construct, std::forward_as_tuple(key),
+              std::forward_as_tuple(std::forward< Args >(args)...)), nullptr, nullptr);
+      }
+      if (comp_(key, node->value->first))
+      {
+        node_ptr left = insert_impl(node->left, key, assign, inserted, std::forward< Args >(args)...);
+        return (left == node->left) ? node : balance(node->value, std::move(left), node->right);
+      }
+      if (comp_(node->value->first, key))
+      {
+        node_ptr right = insert_impl(node->right, key, assign, inserted, std::forward< Args >(args)...);
+        return (right == node->right) ? node : balance(node->value, node->left, std::move(right));
+      }
+      if (!assign)
+      {
+        return node;
+      }
+      return make_node(std::make_shared< value_type >(std::piecewise_construct,
+            std::forward_as_tuple(node->value->first), std::forward_as_tuple(std::forward< Args >(args)...)),
+            node->left, node->right);
+    }
+    node_ptr erase_impl(const node_ptr& node, const key_type& key, bool& erased)
+    {
+      if (node == nullptr)
+      {
+        return node;
+      }
+      if (comp_(key, node->value->first))
+      {
+        node_ptr left = erase_impl(node->left, key, erased);
+        return erased ? balance(node->value, std::move(left), node->right) : node;
+      }
+      if (comp_(node->value->first, key))
+      {
+        node_ptr right = erase_impl(node->right, key, erased);
+        return erased ? balance(node->value, node->left, std::move(right)) : node;
+      }
+      erased = true;
+      if (node->left == nullptr)
+      {
+        return node->right;
+      }
+      if (node->right == nullptr)
+      {
+        return node->left;
+      }
+      const Node* min = node->right.get();
+      while (min->left != nullptr)
+      {
+        min = min->left.get();
+      }
+      return balance(min->value, node->left, erase_min(node->right));
+    }
+    static node_ptr erase_min(const node_ptr& node)
+    {
+      if (node->left == nullptr)
+      {
+        return node->right;
+      }
+      return balance(node->value, erase_min(node->left), node->right);
+    }
+  };
+  template< class K, class T, class C >
+  constexpr size_t PersistentMap< K, T, C >::const_iterator::max_height;
+}
+
+#endif
@@ -1,8 +1,10 @@
 #include "processor.hpp"
 
 #include <iostream>
-#include <fstream>
+#include <mapped_file.hpp>
 #include <stdexcept>
+#include <algorithm>
+#include <iterator>
 
 rychkov::S4ParseProcessor::S4ParseProcessor(int argc, char** argv)
 {
@@ -10,30 +12,32 @@ rychkov::S4ParseProcessor::S4ParseProcessor(int argc, char** argv)
   {
     throw std::invalid_argument("wrong arguments count");
   }
-  std::ifstream file(argv[1]);
-  if (!file)
+  MappedFile mapping(argv[1]);
+  if (!mapping.is_open())
   {
     throw std::invalid_argument("failed to open file");
   }
-  std::string name;
-  while (file >> name)
+  TextScanner file(mapping.begin(), mapping.end());
+  CharRange name_range{};
+  while (file >> name_range)
   {
+    std::string name(name_range.data, name_range.size);
     if (map.contains(name))
     {
       throw std::runtime_error("map name repeated");
     }
-    inner_map& link = map[name];
+    inner_map& link = map[std::move(name)];
     int key = 0;
     while (file >> key)
     {
-      std::string str;
+      CharRange str{};
       if (!(file >> str))
       {
         throw std::runtime_error("failed to read string for key");
       }
-      link.try_emplace(key, std::move(str));
+      link.try_emplace(key, str.data, str.size);
     }
-    file.clear(file.rdstate() & ~std::ios::failbit);
+    file.clear_fail();
   }
 }
 bool rychkov::S4ParseProcessor::print(ParserContext& context)
@@ -72,13 +76,8 @@ bool rychkov::S4ParseProcessor::make_complement(ParserContext& context)
   const inner_map& lhslink = map.at(lhs);
   const inner_map& rhslink = map.at(rhs);
   inner_map temp;
-  for (const inner_map::value_type& i: lhslink)
-  {
-    if (!rhslink.contains(i.first))
-    {
-      temp.insert(i);
-    }
-  }
+  std::set_difference(lhslink.begin(), lhslink.end(), rhslink.begin(), rhslink.end(),
+        std::inserter(temp, temp.end()), temp.value_comp());
   link = std::move(temp);
   return true;
 }
@@ -93,13 +92,8 @@ bool rychkov::S4ParseProcessor::make_intersect(ParserContext& context)
   const inner_map& lhslink = map.at(lhs);
   const inner_map& rhslink = map.at(rhs);
   inner_map temp;
-  for (const inner_map::value_type& i: lhslink)
-  {
-    if (rhslink.contains(i.first))
-    {
-      temp.insert(i);
-    }
-  }
+  std::set_intersection(lhslink.begin(), lhslink.end(), rhslink.begin(), rhslink.end(),
+        std::inserter(temp, temp.end()), temp.value_comp());
   link = std::move(temp);
   return true;
 }
@@ -113,8 +107,9 @@ bool rychkov::S4ParseProcessor::make_union(ParserContext& context)
   inner_map& link = map[name];
   const inner_map& lhslink = map.at(lhs);
   const inner_map& rhslink = map.at(rhs);
-  inner_map temp = lhslink;
-  temp.insert(rhslink.begin(), rhslink.end());
+  inner_map temp;
+  std::set_union(lhslink.begin(), lhslink.end(), rhslink.begin(), rhslink.end(),
+        std::inserter(temp, temp.end()), temp.value_comp());
   link = std::move(temp);
   return true;
 }
@@ -6,10 +6,15 @@
 
 namespace rychkov
 {
-  template< class K, class C = std::less<>, size_t N = 2 >
-  using Set = MapBase< K, K, C, N, true, false >;
-  template< class K, class C = std::less<>, size_t N = 2 >
-  using MultiSet = MapBase< K, K, C, N, true, true >;
+  template< class K, class C = std::less<>, size_t N = 2, class A = PoolAllocator< K > >
+  using Set = MapBase< K, K, C, N, true, false, A >;
+  template< class K, class C = std::less<>, size_t N = 2, class A = PoolAllocator< K > >
+  using MultiSet = MapBase< K, K, C, N, true, true, A >;
+
+  template< class K, class C = std::less<>, size_t N = cache_fit_capacity_v< K >, class A = PoolAllocator< K > >
+  using WideSet = MapBase< K, K, C, N, true, false, A >;
+  template< class K, class C = std::less<>, size_t N = cache_fit_capacity_v< K >, class A = PoolAllocator< K > >
+  using WideMultiSet = MapBase< K, K, C, N, true, true, A >;
 }
 
 #endif
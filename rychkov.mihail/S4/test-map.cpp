@@ -4,10 +4,14 @@
 #include <chrono>
 #include <algorithm>
 #include <iterator>
+#include <map>
+#include <string>
+#include <memory>
 #include <boost/test/unit_test.hpp>
 #include <mem_checker.hpp>
 #include "map.hpp"
 #include "set.hpp"
+#include "persistent_map.hpp"
 
 BOOST_AUTO_TEST_SUITE(S4_map_test)
 
@@ -26,6 +30,7 @@ BOOST_AUTO_TEST_CASE(empty_test)
   BOOST_TEST((map.find(234) == map.end()));
   BOOST_TEST(!map.contains(93));
   BOOST_TEST((map.begin() == map.end()));
+  BOOST_TEST((map.rbegin() == map.rend()));
   BOOST_CHECK_THROW(map.at(0), std::out_of_range);
 }
 BOOST_AUTO_TEST_CASE(map_test)
@@ -59,6 +64,28 @@ BOOST_AUTO_TEST_CASE(erase_test)
   BOOST_TEST((set.erase(set.begin(), set.end()) == set.end()));
   BOOST_TEST(set.empty());
 }
+BOOST_AUTO_TEST_CASE(end_hint_test)
+{
+  rychkov::Map< int, char > map;
+  for (int i = 0; i < 64; i++)
+  {
+    rychkov::Map< int, char >::iterator result = map.insert(map.end(), {i * 2, 'a'});
+    BOOST_TEST(result->first == i * 2);
+    BOOST_TEST((++result == map.end()));
+  }
+  BOOST_TEST(map.size() == 64);
+  BOOST_TEST(map.insert(map.end(), {10, 'b'})->second == 'a');
+  BOOST_TEST(map.insert(map.end(), {11, 'b'})->first == 11);
+  BOOST_TEST(map.size() == 65);
+
+  rychkov::Map< int, char > lhs = {{1, 'a'}, {3, 'b'}, {5, 'c'}};
+  rychkov::Map< int, char > rhs = {{2, 'd'}, {3, 'e'}, {6, 'f'}};
+  rychkov::Map< int, char > merged;
+  std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+        std::inserter(merged, merged.end()), merged.value_comp());
+  rychkov::Map< int, char > expected = {{1, 'a'}, {2, 'd'}, {3, 'b'}, {5, 'c'}, {6, 'f'}};
+  BOOST_TEST(std::equal(merged.begin(), merged.end(), expected.begin(), expected.end()));
+}
 BOOST_AUTO_TEST_CASE(random_test)
 {
   struct Wrapper
@@ -100,5 +127,165 @@ BOOST_AUTO_TEST_CASE(random_test)
     BOOST_TEST(set.size() == size);
   }
 }
+BOOST_AUTO_TEST_CASE(wide_node_test)
+{
+  using map_type = rychkov::WideMap< int, int >;
+  static_assert(map_type::iterator::node_capacity == rychkov::cache_fit_capacity_v< std::pair< int, int > >, "");
+  map_type map;
+  std::map< int, int > expected;
+  std::mt19937 engine;
+  for (int i = 0; i < 20000; i++)
+  {
+    int key = engine() % 1000;
+    if (engine() % 3 == 0)
+    {
+      BOOST_TEST(map.erase(key) == expected.erase(key));
+      continue;
+    }
+    BOOST_TEST(map.emplace(key, i).second == expected.emplace(key, i).second);
+    map_type::iterator lower = map.lower_bound(key / 2);
+    std::map< int, int >::iterator expected_lower = expected.lower_bound(key / 2);
+    BOOST_TEST(lower->first == expected_lower->first);
+    map_type::iterator upper = map.upper_bound(key);
+    BOOST_TEST(((upper == map.end()) ? -1 : upper->first) ==
+          ((expected.upper_bound(key) == expected.end()) ? -1 : expected.upper_bound(key)->first));
+  }
+  BOOST_TEST(map.size() == expected.size());
+  BOOST_TEST(std::equal(map.begin(), map.end(), expected.begin(), expected.end()));
+  BOOST_TEST(std::equal(map.rbegin(), map.rend(), expected.rbegin(), expected.rend()));
+}
+BOOST_AUTO_TEST_CASE(node_pool_test)
+{
+  struct Wrapper
+  {
+    std::string value;
+    bool operator<(const Wrapper& rhs) const
+    {
+      return value < rhs.value;
+    }
+  };
+  rychkov::MemTrack< Wrapper > observer{};
+  using set_type = rychkov::Set< rychkov::MemChecker< Wrapper >, std::less<>, 4 >;
+  using plain_set_type = rychkov::Set< int, std::less<>, 4, std::allocator< int > >;
+  set_type set;
+  plain_set_type plain_set;
+  std::mt19937 engine;
+  for (int round = 0; round < 3; round++)
+  {
+    for (int i = 0; i < 4000; i++)
+    {
+      int key = engine() % 500;
+      if (engine() % 2 == 0)
+      {
+        set.erase(Wrapper{std::to_string(key)});
+        plain_set.erase(key);
+      }
+      else
+      {
+        set.emplace(Wrapper{std::to_string(key)});
+        plain_set.emplace(key);
+      }
+    }
+    set_type set_copy = set;
+    plain_set_type plain_copy = plain_set;
+    BOOST_TEST(set_copy.size() == set.size());
+    BOOST_TEST(std::equal(set.begin(), set.end(), set_copy.begin(), set_copy.end(),
+          [](const Wrapper& lhs, const Wrapper& rhs){ return lhs.value == rhs.value; }));
+    BOOST_TEST(std::equal(set.rbegin(), set.rend(), set_copy.rbegin(), set_copy.rend(),
+          [](const Wrapper& lhs, const Wrapper& rhs){ return lhs.value == rhs.value; }));
+    BOOST_TEST(std::equal(plain_set.begin(), plain_set.end(), plain_copy.begin(), plain_copy.end()));
+    set_copy.emplace(Wrapper{"copy only"});
+    BOOST_TEST(!set.contains(Wrapper{"copy only"}));
+    set.clear();
+    BOOST_TEST(set.empty());
+    set = set_copy;
+    BOOST_TEST(set.erase(Wrapper{"copy only"}) == 1);
+    BOOST_TEST(set.size() + 1 == set_copy.size());
+  }
+}
+BOOST_AUTO_TEST_CASE(order_statistics_test)
+{
+  using map_type = rychkov::MultiMap< int, int, std::less<>, 3 >;
+  map_type map;
+  std::multimap< int, int > expected;
+  std::mt19937 engine;
+  for (int i = 0; i < 5000; i++)
+  {
+    int key = engine() % 300;
+    if (engine() % 3 == 0)
+    {
+      BOOST_TEST(map.erase(key) == expected.erase(key));
+      continue;
+    }
+    map.emplace(key, i);
+    expected.emplace(key, i);
+    size_t expected_rank = std::distance(expected.begin(), expected.lower_bound(key));
+    BOOST_TEST(map.rank(key) == expected_rank);
+    BOOST_TEST(map.nth(expected_rank)->first == key);
+    BOOST_TEST(map.count(key) == expected.count(key));
+  }
+  const map_type& const_map = map;
+  size_t pos = 0;
+  for (map_type::const_iterator i = const_map.begin(); i != const_map.end(); ++i, pos++)
+  {
+    BOOST_TEST((const_map.nth(pos) == i));
+    BOOST_TEST(const_map.distance(const_map.begin(), i) == pos);
+    BOOST_TEST(const_map.distance(i, const_map.end()) == map.size() - pos);
+  }
+  BOOST_TEST((const_map.nth(pos) == const_map.end()));
+  BOOST_TEST(map.rank(1000) == map.size());
+}
+
+BOOST_AUTO_TEST_CASE(persistent_map_test)
+{
+  using map_type = rychkov::PersistentMap< int, std::string >;
+  map_type map;
+  std::map< int, std::string > expected;
+  std::mt19937 engine;
+  map_type::Snapshot empty = map.snapshot();
+  map_type::Snapshot middle;
+  std::map< int, std::string > expected_middle;
+  for (int i = 0; i < 6000; i++)
+  {
+    int key = engine() % 700;
+    switch (engine() % 4)
+    {
+    case 0:
+      BOOST_TEST(map.erase(key) == expected.erase(key));
+      break;
+    case 1:
+      BOOST_TEST(map.insert_or_assign(key, std::to_string(i)) == !expected.count(key));
+      expected[key] = std::to_string(i);
+      break;
+    default:
+      BOOST_TEST(map.try_emplace(key, 3, 'a' + key % 26) == expected.emplace(key, std::string(3, 'a' + key % 26)).second);
+    }
+    if (i == 3000)
+    {
+      middle = map.snapshot();
+      expected_middle = expected;
+    }
+  }
+  map_type::Snapshot last = map.snapshot();
+  BOOST_TEST(last.size() == expected.size());
+  BOOST_TEST(std::equal(last.begin(), last.end(), expected.begin(), expected.end()));
+  BOOST_TEST(std::equal(middle.begin(), middle.end(), expected_middle.begin(), expected_middle.end()));
+  BOOST_TEST(middle.size() == expected_middle.size());
+  for (int key = 0; key < 700; key += 7)
+  {
+    map_type::const_iterator found = last.find(key);
+    BOOST_TEST(((found == last.end()) == !expected.count(key)));
+    if (found != last.end())
+    {
+      BOOST_TEST(found->second == expected[key]);
+      BOOST_TEST(std::equal(found, last.end(), expected.find(key), expected.end()));
+    }
+  }
+  BOOST_CHECK_THROW(last.at(-1), std::out_of_range);
+  map.clear();
+  BOOST_TEST(map.empty());
+  BOOST_TEST(empty.empty());
+  BOOST_TEST(last.size() == expected.size());
+}
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,34 @@
+#include <string>
+#include <unistd.h>
+#include <boost/test/unit_test.hpp>
+#include <mapped_file.hpp>
+
+BOOST_AUTO_TEST_SUITE(S4_mapped_file_test)
+
+BOOST_AUTO_TEST_CASE(pipe_test)
+{
+  std::string text = "first 1 a 2 b\n" + std::string(5000, ' ') + "second 3 c\n";
+  int fds[2];
+  BOOST_REQUIRE(::pipe(fds) == 0);
+  BOOST_REQUIRE(::write(fds[1], text.data(), text.size()) == static_cast< ssize_t >(text.size()));
+  ::close(fds[1]);
+  std::string path = "/dev/fd/" + std::to_string(fds[0]);
+  rychkov::MappedFile file(path.c_str());
+  ::close(fds[0]);
+
+  BOOST_TEST(file.is_open());
+  BOOST_TEST(std::string(file.begin(), file.end()) == text);
+  rychkov::TextScanner scanner(file.begin(), file.end());
+  rychkov::CharRange word{};
+  int key = 0;
+  BOOST_TEST(static_cast< bool >(scanner >> word >> key));
+  BOOST_TEST(std::string(word.data, word.size) == "first");
+  BOOST_TEST(key == 1);
+}
+BOOST_AUTO_TEST_CASE(missing_file_test)
+{
+  rychkov::MappedFile file("/nonexistent/file");
+  BOOST_TEST(!file.is_open());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
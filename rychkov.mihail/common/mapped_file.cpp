@@ -0,0 +1,174 @@
+#include "mapped_file.hpp"
+
+#include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+  bool is_space(char c) noexcept
+  {
+    return (c == ' ') || ((c >= '\t') && (c <= '\r'));
+  }
+  bool is_digit(char c) noexcept
+  {
+    return (c >= '0') && (c <= '9');
+  }
+}
+
+rychkov::MappedFile::MappedFile(const char* filename):
+  data_(nullptr),
+  size_(0),
+  mapped_(false),
+  open_(false)
+{
+  int fd = ::open(filename, O_RDONLY);
+  if (fd < 0)
+  {
+    return;
+  }
+  open_ = true;
+  struct stat info;
+  bool regular = (::fstat(fd, &info) == 0) && S_ISREG(info.st_mode);
+  if (regular && (info.st_size > 0))
+  {
+    void* mapping = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED)
+    {
+      ::madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+      data_ = static_cast< char* >(mapping);
+      size_ = info.st_size;
+      mapped_ = true;
+    }
+  }
+  if (!mapped_)
+  {
+    try
+    {
+      read_all(fd);
+    }
+    catch (...)
+    {
+      ::close(fd);
+      throw;
+    }
+  }
+  ::close(fd);
+}
+rychkov::MappedFile::~MappedFile()
+{
+  if (mapped_)
+  {
+    ::munmap(data_, size_);
+  }
+}
+bool rychkov::MappedFile::is_open() const noexcept
+{
+  return open_;
+}
+const char* rychkov::MappedFile::begin() const noexcept
+{
+  return data_;
+}
+const char* rychkov::MappedFile::end() const noexcept
+{
+  return data_ + size_;
+}
+void rychkov::MappedFile::read_all(int fd)
+{
+  buffer_.resize(4096);
+  ssize_t count = 0;
+  while ((count = ::read(fd, &buffer_[size_], buffer_.size() - size_)) > 0)
+  {
+    size_ += count;
+    if (size_ == buffer_.size())
+    {
+      buffer_.resize(size_ * 2);
+    }
+  }
+  data_ = &buffer_[0];
+}
+
+rychkov::TextScanner::TextScanner(const char* first, const char* last) noexcept:
+  pos_(first),
+  last_(last),
+  eof_(false),
+  fail_(false)
+{}
+rychkov::TextScanner::operator bool() const noexcept
+{
+  return !fail_;
+}
+void rychkov::TextScanner::clear_fail() noexcept
+{
+  fail_ = false;
+}
+rychkov::TextScanner& rychkov::TextScanner::operator>>(CharRange& word) noexcept
+{
+  if (!skip_spaces())
+  {
+    return *this;
+  }
+  const char* first = pos_;
+  while ((pos_ != last_) && !is_space(*pos_))
+  {
+    pos_++;
+  }
+  eof_ = (pos_ == last_);
+  word = {first, static_cast< size_t >(pos_ - first)};
+  return *this;
+}
+rychkov::TextScanner& rychkov::TextScanner::operator>>(int& value) noexcept
+{
+  if (!skip_spaces())
+  {
+    return *this;
+  }
+  bool negative = (*pos_ == '-');
+  if (negative || (*pos_ == '+'))
+  {
+    pos_++;
+  }
+  const unsigned long long max = std::numeric_limits< int >::max() + (negative ? 1ULL : 0ULL);
+  unsigned long long result = 0;
+  bool overflow = false;
+  const char* digits = pos_;
+  for (; (pos_ != last_) && is_digit(*pos_); pos_++)
+  {
+    unsigned long long digit = *pos_ - '0';
+    overflow = overflow || (result > (max - digit) / 10);
+    result = overflow ? result : result * 10 + digit;
+  }
+  eof_ = (pos_ == last_);
+  if ((pos_ == digits) || overflow)
+  {
+    fail_ = true;
+  }
+  else
+  {
+    long long signed_result = static_cast< long long >(result);
+    value = static_cast< int >(negative ? -signed_result : signed_result);
+  }
+  return *this;
+}
+bool rychkov::TextScanner::skip_spaces() noexcept
+{
+  if (eof_ || fail_)
+  {
+    fail_ = true;
+    return false;
+  }
+  while ((pos_ != last_) && is_space(*pos_))
+  {
+    pos_++;
+  }
+  if (pos_ == last_)
+  {
+    eof_ = true;
+    fail_ = true;
+    return false;
+  }
+  return true;
+}
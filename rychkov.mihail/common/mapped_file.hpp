@@ -0,0 +1,56 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace rychkov
+{
+  struct CharRange
+  {
+    const char* data;
+    size_t size;
+  };
+
+  class MappedFile
+  {
+  public:
+    explicit MappedFile(const char* filename);
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile();
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool is_open() const noexcept;
+    const char* begin() const noexcept;
+    const char* end() const noexcept;
+  private:
+    char* data_;
+    size_t size_;
+    bool mapped_;
+    bool open_;
+    std::string buffer_;
+
+    void read_all(int fd);
+  };
+
+  class TextScanner
+  {
+  public:
+    TextScanner(const char* first, const char* last) noexcept;
+
+    explicit operator bool() const noexcept;
+    void clear_fail() noexcept;
+
+    TextScanner& operator>>(CharRange& word) noexcept;
+    TextScanner& operator>>(int& value) noexcept;
+  private:
+    const char* pos_;
+    const char* last_;
+    bool eof_;
+    bool fail_;
+
+    bool skip_spaces() noexcept;
+  };
+}
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include "type_traits.hpp"
+
+namespace rychkov
+{
+  template< class T >
+  class PoolAllocator
+  {
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    static constexpr size_type first_slab_size = 16;
+    static constexpr size_type max_slab_size = 4096;
+
+    PoolAllocator() noexcept = default;
+    template< class U >
+    PoolAllocator(const PoolAllocator< U >&) noexcept
+    {}
+
+    T* allocate(size_type n)
+    {
+      if (n != 1)
+      {
+        return static_cast< T* >(::operator new(n * sizeof(T)));
+      }
+      if (!pool_)
+      {
+        pool_ = std::make_shared< Pool >();
+      }
+      Pool& pool = *pool_;
+      if (pool.free != nullptr)
+      {
+        return reinterpret_cast< T* >(std::exchange(pool.free, pool.free->next));
+      }
+      if (pool.bump == pool.bump_end)
+      {
+        pool.add_slab(pool.next_slab_size);
+        pool.next_slab_size = std::min(pool.next_slab_size * 2, max_slab_size);
+      }
+      return reinterpret_cast< T* >(pool.bump++);
+    }
+    void deallocate(T* p, size_type n) noexcept
+    {
+      if (n != 1)
+      {
+        ::operator delete(p);
+        return;
+      }
+      Slot* slot = reinterpret_cast< Slot* >(p);
+      slot->next = pool_->free;
+      pool_->free = slot;
+    }
+    void reserve(size_type n)
+    {
+      if (!pool_)
+      {
+        pool_ = std::make_shared< Pool >();
+      }
+      if (static_cast< size_type >(pool_->bump_end - pool_->bump) < n)
+      {
+        pool_->add_slab(n);
+      }
+    }
+    void release() noexcept
+    {
+      if (pool_)
+      {
+        pool_->release();
+      }
+    }
+    PoolAllocator select_on_container_copy_construction() const noexcept
+    {
+      return {};
+    }
+
+    bool operator==(const PoolAllocator& rhs) const noexcept
+    {
+      return pool_ == rhs.pool_;
+    }
+    bool operator!=(const PoolAllocator& rhs) const noexcept
+    {
+      return pool_ != rhs.pool_;
+    }
+  private:
+    union Slot
+    {
+      Slot* next;
+      alignas(T) unsigned char data[sizeof(T)];
+    };
+    struct Pool
+    {
+      Slot* slabs = nullptr;
+      Slot* free = nullptr;
+      Slot* bump = nullptr;
+      Slot* bump_end = nullptr;
+      size_type next_slab_size = first_slab_size;
+
+      ~Pool()
+      {
+        release();
+      }
+      void add_slab(size_type n)
+      {
+        Slot* slab = static_cast< Slot* >(::operator new((n + 1) * sizeof(Slot)));
+        for (; bump != bump_end; bump++)
+        {
+          bump->next = free;
+          free = bump;
+        }
+        slab->next = slabs;
+        slabs = slab;
+        bump = slab + 1;
+        bump_end = bump + n;
+      }
+      void release() noexcept
+      {
+        while (slabs != nullptr)
+        {
+          ::operator delete(std::exchange(slabs, slabs->next));
+        }
+        free = bump = bump_end = nullptr;
+        next_slab_size = first_slab_size;
+      }
+    };
+    std::shared_ptr< Pool > pool_;
+  };
+  template< class T >
+  constexpr typename PoolAllocator< T >::size_type PoolAllocator< T >::first_slab_size;
+  template< class T >
+  constexpr typename PoolAllocator< T >::size_type PoolAllocator< T >::max_slab_size;
+
+  template< class Alloc, class = void >
+  struct is_pool_allocator: std::false_type
+  {};
+  template< class Alloc >
+  struct is_pool_allocator< Alloc, void_t< decltype(std::declval< Alloc& >().reserve(size_t())),
+        decltype(std::declval< Alloc& >().release()) > >: std::true_type
+  {};
+  template< class Alloc >
+  constexpr bool is_pool_allocator_v = is_pool_allocator< Alloc >::value;
+}
+
+#endif
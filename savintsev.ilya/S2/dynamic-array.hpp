@@ -1,6 +1,9 @@
 #ifndef DYNAMIC_ARRAY_H
 #define DYNAMIC_ARRAY_H
 #include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <lrgcpy.hpp>
 
 namespace savintsev
@@ -29,6 +32,7 @@ namespace savintsev
     void push_back(U && rhs);
     void pop_front() noexcept;
     void pop_back() noexcept;
+    void clear() noexcept;
 
     template< typename U >
     friend void swap(Array< U > & x, Array< U > & y) noexcept;
@@ -50,7 +54,7 @@ namespace savintsev
 
   template< typename T >
   Array< T >::Array(size_t n):
-    data_(new T[n]),
+    data_(allocateRaw< T >(n)),
     size_(0),
     start_(0),
     capacity_(n)
@@ -66,16 +70,17 @@ namespace savintsev
 
   template< typename T >
   Array< T >::Array(Array && rhs) noexcept:
-    data_(rhs.data_),
-    size_(rhs.size_),
-    start_(rhs.start_),
-    capacity_(rhs.capacity_)
+    data_(std::exchange(rhs.data_, nullptr)),
+    size_(std::exchange(rhs.size_, 0)),
+    start_(std::exchange(rhs.start_, 0)),
+    capacity_(std::exchange(rhs.capacity_, 0))
   {}
 
   template< typename T >
   Array< T >::~Array()
   {
-    delete[] data_;
+    destroyRange(data_ + start_, size_);
+    ::operator delete(data_);
   }
 
   template< typename T >
@@ -136,23 +141,34 @@ namespace savintsev
   {
     if (size_ + start_ < capacity_)
     {
-      data_[size_ + start_] = std::forward< U >(rhs);
+      new (data_ + start_ + size_) T(std::forward< U >(rhs));
       size_++;
       return;
     }
-    T * arr = createExpandCopy(data_ + start_, size_, capacity_ + capacity_);
+    size_t new_capacity = capacity_ ? capacity_ + capacity_ : 1;
+    T * arr = allocateRaw< T >(new_capacity);
+    try
+    {
+      new (arr + size_) T(std::forward< U >(rhs));
+    }
+    catch (...)
+    {
+      ::operator delete(arr);
+      throw;
+    }
     try
     {
-      arr[size_] = std::forward< U >(rhs);
+      relocate(arr, data_ + start_, size_, std::is_trivially_copyable< T >{});
     }
     catch (...)
     {
-      delete[] arr;
+      arr[size_].~T();
+      ::operator delete(arr);
       throw;
     }
-    delete[] data_;
+    ::operator delete(data_);
     data_ = arr;
-    capacity_ += capacity_;
+    capacity_ = new_capacity;
     start_ = 0;
     size_++;
   }
@@ -161,13 +177,31 @@ namespace savintsev
   void Array< T >::pop_back() noexcept
   {
     size_--;
+    data_[start_ + size_].~T();
+    if (!size_)
+    {
+      start_ = 0;
+    }
   }
 
   template< typename T >
   void Array< T >::pop_front() noexcept
   {
+    data_[start_].~T();
     ++start_;
     --size_;
+    if (!size_)
+    {
+      start_ = 0;
+    }
+  }
+
+  template< typename T >
+  void Array< T >::clear() noexcept
+  {
+    destroyRange(data_ + start_, size_);
+    size_ = 0;
+    start_ = 0;
   }
 }
 
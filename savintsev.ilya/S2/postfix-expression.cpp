@@ -123,14 +123,73 @@ namespace
   {
     return (a % b + b) % b;
   }
+
+  bool is_operator(const std::string & token)
+  {
+    if (token.size() != 1)
+    {
+      return false;
+    }
+    char c = token[0];
+    return c == '+' || c == '-' || c == '*' || c == '/' || c == '%';
+  }
+
+  void process(const std::string & token, savintsev::Stack< long long > & calc)
+  {
+    if (!is_operator(token))
+    {
+      try
+      {
+        calc.push(std::stoll(token));
+        return;
+      }
+      catch (const std::invalid_argument &)
+      {}
+    }
+    if (calc.size() < 2)
+    {
+      throw std::invalid_argument("ERROR: invalid expression");
+    }
+    long long r = calc.top();
+    calc.pop();
+    long long l = calc.top();
+    calc.pop();
+    switch (*(token.data()))
+    {
+    case '+':
+      calc.push(sum(l, r));
+      break;
+    case '-':
+      calc.push(diff(l, r));
+      break;
+    case '*':
+      calc.push(prod(l, r));
+      break;
+    case '/':
+      calc.push(quot(l, r));
+      break;
+    case '%':
+      calc.push(rem(l, r));
+      break;
+    }
+  }
 }
 
 savintsev::PostfixExpr savintsev::convert(const std::string & infix)
 {
   PostfixExpr postfix;
+  Stack< std::string > stack;
+  convert(infix, postfix, stack);
+  postfix();
+  return postfix;
+}
+
+void savintsev::convert(const std::string & infix, PostfixExpr & postfix, Stack< std::string > & stack)
+{
   using str = std::string;
 
-  Stack< str > stack;
+  postfix.expr_.clear();
+  stack.clear();
 
   size_t was_bracket = 0;
 
@@ -204,59 +263,22 @@ savintsev::PostfixExpr savintsev::convert(const std::string & infix)
   {
     throw std::invalid_argument("ERROR: invalid expression");
   }
-  postfix();
-  return postfix;
 }
 
 long long savintsev::PostfixExpr::operator()() const
 {
-  Queue< std::string > expr(expr_);
+  PostfixExpr copy(*this);
   Stack< long long > calc;
+  return copy.consume(calc);
+}
 
-  while (expr.size())
+long long savintsev::PostfixExpr::consume(Stack< long long > & calc)
+{
+  calc.clear();
+  while (expr_.size())
   {
-    std::string token = expr.front();
-    expr.pop();
-    try
-    {
-      long long num = std::stoll(token);
-      calc.push(num);
-    }
-    catch (const std::invalid_argument & e)
-    {
-      if (calc.size() < 2)
-      {
-        throw std::invalid_argument("ERROR: invalid expression");
-      }
-      long long r = calc.top();
-      calc.pop();
-      long long l = calc.top();
-      calc.pop();
-      long long result = 0;
-      switch (*(token.data()))
-      {
-      case '+':
-        result = sum(l, r);
-        calc.push(result);
-        break;
-      case '-':
-        result = diff(l, r);
-        calc.push(result);
-        break;
-      case '*':
-        result = prod(l, r);
-        calc.push(result);
-        break;
-      case '/':
-        result = quot(l, r);
-        calc.push(result);
-        break;
-      case '%':
-        result = rem(l, r);
-        calc.push(result);
-        break;
-      }
-    }
+    process(expr_.front(), calc);
+    expr_.pop();
   }
   if (calc.size() == 1)
   {
@@ -2,6 +2,7 @@
 #define POSTFIX_EXPRESSION_H
 #include <string>
 #include "queue.hpp"
+#include "stack.hpp"
 
 namespace savintsev
 {
@@ -9,6 +10,7 @@ namespace savintsev
   {
   public:
     long long operator()() const;
+    long long consume(Stack< long long > & calc);
 
     PostfixExpr operator+(const PostfixExpr & rhs);
     PostfixExpr operator-(const PostfixExpr & rhs);
@@ -17,6 +19,7 @@ namespace savintsev
     PostfixExpr operator%(const PostfixExpr & rhs);
 
     friend PostfixExpr convert(const std::string & infix);
+    friend void convert(const std::string & infix, PostfixExpr & postfix, Stack< std::string > & stack);
   private:
     Queue< std::string > expr_;
 
@@ -24,6 +27,7 @@ namespace savintsev
   };
 
   PostfixExpr convert(const std::string & infix);
+  void convert(const std::string & infix, PostfixExpr & postfix, Stack< std::string > & stack);
 }
 
 #endif
@@ -8,6 +8,9 @@ void savintsev::evaluate_postfix_stream(std::istream & in)
 
   string text;
   Stack< long long > results;
+  Stack< string > operators;
+  Stack< long long > calc;
+  PostfixExpr expr;
 
   while (in)
   {
@@ -17,8 +20,8 @@ void savintsev::evaluate_postfix_stream(std::istream & in)
       continue;
     }
 
-    PostfixExpr expr = convert(text);
-    results.push(expr());
+    convert(text, expr, operators);
+    results.push(expr.consume(calc));
   }
 
   if (results.empty())
@@ -13,6 +13,7 @@ namespace savintsev
     bool empty() const noexcept;
 
     void pop() noexcept;
+    void clear() noexcept;
     template< typename U >
     void push(U && rhs);
 
@@ -52,6 +53,12 @@ namespace savintsev
     queue_.pop_front();
   }
 
+  template< typename T >
+  void Queue< T >::clear() noexcept
+  {
+    queue_.clear();
+  }
+
   template< typename T >
   template< typename U >
   void Queue< T >::push(U && rhs)
@@ -13,6 +13,7 @@ namespace savintsev
     bool empty() const noexcept;
 
     void pop() noexcept;
+    void clear() noexcept;
     template< typename U >
     void push(U && rhs);
 
@@ -50,6 +51,12 @@ namespace savintsev
     stack_.pop_back();
   }
 
+  template< typename T >
+  void Stack< T >::clear() noexcept
+  {
+    stack_.clear();
+  }
+
   template< typename T >
   template< typename U >
   void Stack< T >::push(U && rhs)
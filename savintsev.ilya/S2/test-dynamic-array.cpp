@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <string>
 #include "dynamic-array.hpp"
 
 using namespace savintsev;
@@ -31,3 +32,23 @@ BOOST_AUTO_TEST_CASE(test_constr)
   BOOST_TEST(n.front() == 456);
   BOOST_TEST(n.back() == 789);
 }
+
+BOOST_AUTO_TEST_CASE(test_strings)
+{
+  Array< std::string > m(2);
+  for (int i = 0; i < 20; ++i)
+  {
+    m.push_back(std::string(30, 'a' + i));
+  }
+  m.pop_front();
+  m.push_back(m.front());
+  BOOST_TEST(m.size() == 20);
+  BOOST_TEST(m.front() == std::string(30, 'b'));
+  BOOST_TEST(m.back() == std::string(30, 'b'));
+
+  Array< std::string > n(std::move(m));
+  BOOST_TEST(n.size() == 20);
+  BOOST_TEST(m.empty());
+  n.pop_back();
+  BOOST_TEST(n.back() == std::string(30, 't'));
+}
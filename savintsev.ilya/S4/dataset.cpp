@@ -1,32 +1,38 @@
 #include "dataset.h"
 #include <iostream>
-#include <fstream>
+#include <mapped-file.hpp>
 
 namespace savintsev
 {
   DatasetCollection load_dataset_from(const std::string & filename)
   {
-    std::ifstream file(filename);
+    MappedFile mapping(filename.c_str());
 
     DatasetCollection datasets;
 
-    if (!file)
+    if (!mapping.is_open())
     {
       return datasets;
     }
 
+    TokenReader file(mapping.begin(), mapping.end());
     while (file)
     {
-      std::string label;
+      StrView label{"", 0};
       file >> label;
       Dataset values;
       int key;
-      std::string value;
+      StrView value;
       while (file.peek() != '\n' && file)
       {
         if (file >> key >> value)
         {
-          values[key] = value;
+          std::string str = value.str();
+          auto inserted = values.try_emplace(key, std::move(str));
+          if (!inserted.second)
+          {
+            inserted.first->second = std::move(str);
+          }
         }
         else
         {
@@ -34,7 +40,11 @@ namespace savintsev
           break;
         }
       }
-      datasets[label] = std::move(values);
+      auto inserted = datasets.try_emplace(label.str(), std::move(values));
+      if (!inserted.second)
+      {
+        inserted.first->second = std::move(values);
+      }
     }
     return datasets;
   }
@@ -70,7 +80,7 @@ namespace savintsev
       }
       else
       {
-        values[it->first] = it->second;
+        values.insert(*it);
       }
     }
     datasets[newset] = std::move(values);
@@ -88,7 +98,7 @@ namespace savintsev
     {
       if (set2_ref.count(it->first))
       {
-        result[it->first] = it->second;
+        result.insert(*it);
       }
     }
 
@@ -102,10 +112,7 @@ namespace savintsev
     Dataset values = datasets.at(set1);
     for (auto it = datasets.at(set2).begin(); it != datasets.at(set2).end(); ++it)
     {
-      if (!values.count(it->first))
-      {
-        values[it->first] = it->second;
-      }
+      values.insert(*it);
     }
     datasets[newset] = std::move(values);
   }
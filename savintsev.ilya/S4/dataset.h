@@ -6,7 +6,7 @@
 #include "two-three-tree.h"
 
 using Dataset = savintsev::TwoThreeTree< int, std::string >;
-using DatasetCollection = savintsev::TwoThreeTree< std::string, Dataset >;
+using DatasetCollection = savintsev::TwoThreeTree< std::string, Dataset, std::less<> >;
 using DatasetCommands = savintsev::TwoThreeTree< std::string, std::function< void(DatasetCollection &) > >;
 
 namespace savintsev
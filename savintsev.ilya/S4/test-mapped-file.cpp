@@ -0,0 +1,31 @@
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <unistd.h>
+#include <mapped-file.hpp>
+
+BOOST_AUTO_TEST_CASE(test_mapped_file_pipe)
+{
+  std::string text = "first 1 a 2 b\n" + std::string(5000, ' ') + "second 3 c\n";
+  int fds[2];
+  BOOST_REQUIRE(::pipe(fds) == 0);
+  BOOST_REQUIRE(::write(fds[1], text.data(), text.size()) == static_cast< ssize_t >(text.size()));
+  ::close(fds[1]);
+  std::string path = "/dev/fd/" + std::to_string(fds[0]);
+  savintsev::MappedFile file(path.c_str());
+  ::close(fds[0]);
+
+  BOOST_TEST(file.is_open());
+  BOOST_TEST(std::string(file.begin(), file.end()) == text);
+  savintsev::TokenReader reader(file.begin(), file.end());
+  savintsev::StrView word{"", 0};
+  int key = 0;
+  BOOST_TEST(static_cast< bool >(reader >> word >> key));
+  BOOST_TEST(word.str() == "first");
+  BOOST_TEST(key == 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_mapped_file_missing)
+{
+  savintsev::MappedFile file("/nonexistent/file");
+  BOOST_TEST(!file.is_open());
+}
@@ -199,6 +199,27 @@ BOOST_AUTO_TEST_CASE(at_operation)
   BOOST_CHECK_THROW(tree.at(2), std::out_of_range);
 }
 
+BOOST_AUTO_TEST_CASE(transparent_lookup)
+{
+  savintsev::TwoThreeTree< std::string, int, std::less<> > tree;
+  for (int i = 0; i < 40; ++i)
+  {
+    tree[std::to_string(i)] = i;
+  }
+  const char * name = "17";
+
+  BOOST_CHECK(tree.at(name) == 17);
+  BOOST_CHECK(tree.find("3")->second == 3);
+  BOOST_CHECK(tree.find("40") == tree.end());
+  BOOST_CHECK(tree.count("39") == 1);
+  BOOST_CHECK(tree.count("x") == 0);
+  BOOST_CHECK_THROW(tree.at("x"), std::out_of_range);
+
+  const auto & ctree = tree;
+  BOOST_CHECK(ctree.at("25") == 25);
+  BOOST_CHECK(ctree.find(std::string("8"))->second == 8);
+}
+
 BOOST_AUTO_TEST_CASE(subscript_operator)
 {
   savintsev::TwoThreeTree< int, std::string > tree;
@@ -340,3 +361,116 @@ BOOST_AUTO_TEST_CASE(const_methods)
   BOOST_CHECK(tree.count(1) == 1);
 }
 
+
+struct counted_t
+{
+  static int constructed;
+  int value = 0;
+
+  counted_t()
+  {
+    ++constructed;
+  }
+  explicit counted_t(int v):
+    value(v)
+  {
+    ++constructed;
+  }
+  counted_t(const counted_t & other):
+    value(other.value)
+  {
+    ++constructed;
+  }
+  counted_t(counted_t && other) noexcept:
+    value(other.value)
+  {
+    ++constructed;
+  }
+  counted_t & operator=(const counted_t &) = default;
+  counted_t & operator=(counted_t &&) noexcept = default;
+};
+
+int counted_t::constructed = 0;
+
+BOOST_AUTO_TEST_CASE(emplace_operations)
+{
+  savintsev::TwoThreeTree< int, counted_t > tree;
+  counted_t::constructed = 0;
+
+  BOOST_CHECK(tree.try_emplace(1, 10).second);
+  BOOST_CHECK(counted_t::constructed == 1);
+  BOOST_CHECK(!tree.try_emplace(1, 11).second);
+  BOOST_CHECK(counted_t::constructed == 1);
+  BOOST_CHECK(tree.at(1).value == 10);
+
+  tree[2].value = 20;
+  BOOST_CHECK(counted_t::constructed == 2);
+
+  BOOST_CHECK(tree.emplace(3, counted_t(30)).second);
+  BOOST_CHECK(!tree.emplace(3, counted_t(31)).second);
+  BOOST_CHECK(tree.insert(std::make_pair(4, counted_t(40))).second);
+  for (int i = 5; i < 100; ++i)
+  {
+    tree.try_emplace(i, i * 10);
+  }
+  BOOST_CHECK(tree.size() == 99);
+  for (int i = 1; i < 100; ++i)
+  {
+    BOOST_CHECK(tree.at(i).value == i * 10);
+  }
+
+  savintsev::TwoThreeTree< std::string, std::string > strings;
+  std::string key = "key";
+  std::string value = "value";
+  BOOST_CHECK(strings.try_emplace(std::move(key), std::move(value)).second);
+  BOOST_CHECK(value.empty());
+  std::string other = "other";
+  BOOST_CHECK(!strings.try_emplace("key", std::move(other)).second);
+  BOOST_CHECK(other == "other");
+  BOOST_CHECK(strings.at("key") == "value");
+}
+
+BOOST_AUTO_TEST_CASE(key_only_set)
+{
+  savintsev::TwoThreeSet< std::string > set;
+  BOOST_CHECK(set.insert("b").second);
+  BOOST_CHECK(set.insert("a").second);
+  BOOST_CHECK(set.emplace(3, 'c').second);
+  BOOST_CHECK(!set.insert("a").second);
+  BOOST_CHECK(set.size() == 3);
+  BOOST_CHECK(*set.begin() == "a");
+  BOOST_CHECK(*set.find("ccc") == "ccc");
+  BOOST_CHECK(set.count("d") == 0);
+
+  set.erase("b");
+  std::string joined;
+  for (auto it = set.cbegin(); it != set.cend(); ++it)
+  {
+    joined += *it;
+  }
+  BOOST_CHECK(joined == "accc");
+}
+
+BOOST_AUTO_TEST_CASE(erase_every_third)
+{
+  savintsev::TwoThreeTree< int, std::string > tree;
+  for (int i = 0; i < 2000; ++i)
+  {
+    int key = (i * 7919) % 2000;
+    tree[key] = std::to_string(key);
+  }
+  for (int i = 0; i < 2000; i += 3)
+  {
+    BOOST_CHECK(tree.erase(i) == 1);
+  }
+  int expected = 0;
+  for (auto it = tree.begin(); it != tree.end(); ++it, ++expected)
+  {
+    expected += (expected % 3 == 0);
+    BOOST_CHECK(it->first == expected);
+    BOOST_CHECK(it->second == std::to_string(expected));
+    BOOST_CHECK(tree.find(expected) == it);
+  }
+  BOOST_CHECK(tree.size() == 1333);
+  BOOST_CHECK(tree.find(999) == tree.end());
+}
@@ -3,6 +3,8 @@
 #include <functional>
 #include <iostream>
 #include <cassert>
+#include <tuple>
+#include <utility>
 #include "ttt-node.hpp"
 #include "ttt-iterator.hpp"
 #include "ttt-const-iterator.hpp"
@@ -14,9 +16,9 @@ namespace savintsev
   {
   public:
     using key_type = Key;
-    using mapped_type = Value;
-    using value_type = std::pair< Key, Value >;
-    using node_type = node_t< value_type >;
+    using mapped_type = typename ttt_traits< Key, Value >::mapped_type;
+    using value_type = typename ttt_traits< Key, Value >::value_type;
+    using node_type = node_t< Key, Value >;
 
     using iterator = BidirectIterator< Key, Value >;
     using const_iterator = BidirectConstIterator< Key, Value >;
@@ -41,19 +43,36 @@ namespace savintsev
     bool empty() const noexcept;
     size_type size() const noexcept;
     size_type count(const key_type & k) const;
+    template< typename K1, typename C1 = Compare, typename = typename C1::is_transparent >
+    size_type count(const K1 & k) const;
 
     void swap(TwoThreeTree & other) noexcept;
 
     iterator find(const key_type & k);
     const_iterator find (const key_type & k) const;
+    template< typename K1, typename C1 = Compare, typename = typename C1::is_transparent >
+    iterator find(const K1 & k);
+    template< typename K1, typename C1 = Compare, typename = typename C1::is_transparent >
+    const_iterator find(const K1 & k) const;
 
     mapped_type & at(const key_type & k);
     const mapped_type & at(const key_type & k) const;
+    template< typename K1, typename C1 = Compare, typename = typename C1::is_transparent >
+    mapped_type & at(const K1 & k);
+    template< typename K1, typename C1 = Compare, typename = typename C1::is_transparent >
+    const mapped_type & at(const K1 & k) const;
 
     mapped_type & operator[](const key_type & k);
     mapped_type & operator[](key_type && k);
 
     std::pair< iterator, bool > insert(const value_type & val);
+    std::pair< iterator, bool > insert(value_type && val);
+    template< typename... Args >
+    std::pair< iterator, bool > emplace(Args &&... args);
+    template< typename... Args >
+    std::pair< iterator, bool > try_emplace(const key_type & k, Args &&... args);
+    template< typename... Args >
+    std::pair< iterator, bool > try_emplace(key_type && k, Args &&... args);
 
     iterator erase(const_iterator position);
     size_type erase(const key_type & k);
@@ -64,12 +83,14 @@ namespace savintsev
     node_type * root_ = nullptr;
     size_t size_ = 0;
 
-    std::pair< iterator, bool > lazy_find(const key_type & k) const;
-    std::pair< iterator, bool > insert_node(node_type * target, const value_type & val);
+    template< typename K1 >
+    std::pair< iterator, bool > lazy_find(const K1 & k) const;
+    template< typename... Args >
+    std::pair< iterator, bool > insert_node(node_type * target, Args &&... args);
 
     node_type * split_node(node_type * node);
-    void insert_data_in_node(node_type * node, const value_type & val);
-    void remove_data_from_node(node_type * node, const value_type & val);
+    template< typename... Args >
+    size_t insert_data_in_node(node_type * node, Args &&... args);
     void remove_data_from_node(node_type * node, const key_type & k);
     node_type * clear_nodes(node_type * node);
     node_type * clone_nodes(node_type * other);
@@ -79,6 +100,9 @@ namespace savintsev
     node_type * merge_nodes(node_type * leaf);
   };
 
+  template< typename Key, typename Compare = std::less< Key > >
+  using TwoThreeSet = TwoThreeTree< Key, void, Compare >;
+
   template< typename Key, typename Value, typename Compare >
   TwoThreeTree< Key, Value, Compare >::~TwoThreeTree()
   {
@@ -216,6 +240,18 @@ namespace savintsev
     return 0;
   }
 
+  template< typename K, typename V, typename C >
+  template< typename K1, typename C1, typename >
+  typename TwoThreeTree< K, V, C >::size_type TwoThreeTree< K, V, C >::count(const K1 & k) const
+  {
+    auto result = lazy_find(k);
+    if (result.second)
+    {
+      return 1;
+    }
+    return 0;
+  }
+
   template< typename Key, typename Value, typename Compare >
   void TwoThreeTree< Key, Value, Compare >::swap(TwoThreeTree & other) noexcept
   {
@@ -243,30 +279,59 @@ namespace savintsev
     return result.second ? result.first : end();
   }
 
+  template< typename K, typename V, typename C >
+  template< typename K1, typename C1, typename >
+  typename TwoThreeTree< K, V, C >::iterator TwoThreeTree< K, V, C >::find(const K1 & k)
+  {
+    auto result = lazy_find(k);
+    return result.second ? result.first : end();
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename K1, typename C1, typename >
+  typename TwoThreeTree< K, V, C >::const_iterator TwoThreeTree< K, V, C >::find(const K1 & k) const
+  {
+    auto result = lazy_find(k);
+    return result.second ? result.first : end();
+  }
+
   template< typename K, typename V, typename C >
   typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::operator[](const key_type & k)
   {
-    auto res = lazy_find(k);
-    if (res.second)
+    return try_emplace(k).first->second;
+  }
+
+  template< typename K, typename V, typename C >
+  typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::operator[](key_type && k)
+  {
+    return try_emplace(std::move(k)).first->second;
+  }
+
+  template< typename K, typename V, typename C >
+  typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::at(const key_type & k)
+  {
+    auto it_pair = lazy_find(k);
+    if (it_pair.first == end() || !it_pair.second)
     {
-      return res.first->second;
+      throw std::out_of_range("ERROR: Key not found");
     }
-    return insert_node(res.first.node_, {k, mapped_type{}}).first->second;
+    return it_pair.first->second;
   }
 
   template< typename K, typename V, typename C >
-  typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::operator[](key_type && k)
+  const typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::at(const key_type & k) const
   {
-    auto res = lazy_find(k);
-    if (res.second)
+    auto it_pair = lazy_find(k);
+    if (!it_pair.second)
     {
-      return res.first->second;
+      throw std::out_of_range("ERROR: Key not found");
     }
-    return insert_node(res.first.node_, {std::move(k), mapped_type{}}).first->second;
+    return it_pair.first->second;
   }
 
   template< typename K, typename V, typename C >
-  typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::at(const key_type & k)
+  template< typename K1, typename C1, typename >
+  typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::at(const K1 & k)
   {
     auto it_pair = lazy_find(k);
     if (it_pair.first == end() || !it_pair.second)
@@ -277,7 +342,8 @@ namespace savintsev
   }
 
   template< typename K, typename V, typename C >
-  const typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::at(const key_type & k) const
+  template< typename K1, typename C1, typename >
+  const typename TwoThreeTree< K, V, C >::mapped_type & TwoThreeTree< K, V, C >::at(const K1 & k) const
   {
     auto it_pair = lazy_find(k);
     if (!it_pair.second)
@@ -288,12 +354,13 @@ namespace savintsev
   }
 
   template< typename K, typename V, typename C >
+  template< typename K1 >
   std::pair
   <
     typename TwoThreeTree< K, V, C >::iterator,
     bool
   >
-  TwoThreeTree< K, V, C >::lazy_find(const key_type & k) const
+  TwoThreeTree< K, V, C >::lazy_find(const K1 & k) const
   {
     if (!root_)
     {
@@ -303,42 +370,33 @@ namespace savintsev
     while (node)
     {
       assert(node->len <= 3);
-      for (size_t i = 0; i < node->len; ++i)
+      size_t i = 0;
+      while (i < node->len && C{}(node->key(i), k))
       {
-        if (node->data[i].first == k)
-        {
-          return {iterator(root_, node, i), true};
-        }
+        ++i;
       }
-
-      if (!node->kids[0])
+      if (i < node->len && !C{}(k, node->key(i)))
       {
-        return std::make_pair(iterator(root_, node, 0), false);
+        return {iterator(root_, node, i), true};
       }
 
-      if (C{}(k, node->data[0].first))
-      {
-        node = node->kids[0];
-      }
-      else if (node->len == 1 || C{}(k, node->data[1].first))
-      {
-        node = node->kids[1];
-      }
-      else
+      if (!node->kids[0])
       {
-        node = node->kids[2];
+        return std::make_pair(iterator(root_, node, 0), false);
       }
+      node = node->kids[i];
     }
     return {iterator(root_), false};
   }
 
   template< typename K, typename V, typename C >
+  template< typename... Args >
   std::pair
   <
     typename TwoThreeTree< K, V, C >::iterator,
     bool
   >
-  TwoThreeTree< K, V, C >::insert_node(node_type * target, const value_type & val)
+  TwoThreeTree< K, V, C >::insert_node(node_type * target, Args &&... args)
   {
     node_type * old_root = root_;
     size_t old_size = size_;
@@ -350,7 +408,7 @@ namespace savintsev
         node_type * new_node = new node_type{};
         try
         {
-          insert_data_in_node(new_node, val);
+          insert_data_in_node(new_node, std::forward< Args >(args)...);
         }
         catch (...)
         {
@@ -363,13 +421,16 @@ namespace savintsev
       }
 
       node_type * current = target;
-      bool data_inserted = false;
+      size_t pos = insert_data_in_node(current, std::forward< Args >(args)...);
+      if (current->len < 3)
+      {
+        size_++;
+        return {iterator(root_, current, pos), true};
+      }
+      const K key = current->key(pos);
 
       try
       {
-        insert_data_in_node(current, val);
-        data_inserted = true;
-
         while (current && current->len == 3)
         {
           node_type * new_current = split_node(current);
@@ -387,17 +448,14 @@ namespace savintsev
         root_ = current;
         size_++;
 
-        return {lazy_find(val.first).first, true};
+        return {lazy_find(key).first, true};
       }
       catch (...)
       {
-        if (data_inserted)
+        remove_data_from_node(target, key);
+        while (current && current != target)
         {
-          remove_data_from_node(target, val.first);
-          while (current && current != target)
-          {
-            current = merge_nodes(current);
-          }
+          current = merge_nodes(current);
         }
         throw;
       }
@@ -411,73 +469,34 @@ namespace savintsev
   }
 
   template< typename Key, typename Value, typename Compare >
-  void TwoThreeTree< Key, Value, Compare >::insert_data_in_node(node_type * node, const value_type & val)
+  template< typename... Args >
+  size_t TwoThreeTree< Key, Value, Compare >::insert_data_in_node(node_type * node, Args &&... args)
   {
     assert(node->len < 3);
 
-    value_type tmp_data[3];
-    size_t tmp_len = node->len;
-
-    for (size_t i = 0; i < tmp_len; ++i)
+    node->emplace_back(std::forward< Args >(args)...);
+    size_t pos = node->len - 1;
+    for (; pos > 0 && !Compare{}(node->key(pos - 1), node->key(pos)); --pos)
     {
-      tmp_data[i] = node->data[i];
+      std::swap(node->data[pos - 1], node->data[pos]);
     }
-
-    tmp_data[tmp_len++] = val;
-
-    if (tmp_len == 2)
-    {
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-    }
-    else if (tmp_len == 3)
-    {
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-      if (!Compare{}(tmp_data[1].first, tmp_data[2].first))
-      {
-        std::swap(tmp_data[1], tmp_data[2]);
-      }
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-    }
-
-    for (size_t i = 0; i < tmp_len; ++i)
-    {
-      node->data[i] = std::move(tmp_data[i]);
-    }
-    node->len = tmp_len;
-  }
-
-  template< typename Key, typename Value, typename Compare >
-  void TwoThreeTree< Key, Value, Compare >::remove_data_from_node(node_type * node, const value_type & val)
-  {
-    remove_data_from_node(node, val.first);
+    return pos;
   }
 
   template< typename Key, typename Value, typename Compare >
   void TwoThreeTree< Key, Value, Compare >::remove_data_from_node(node_type * node, const key_type & k)
   {
-    if (node->len == 0)
+    for (size_t i = 0; i < node->len; ++i)
     {
-      return;
-    }
-    if (node->len >= 1 && node->data[0].first == k)
-    {
-      node->data[0] = node->data[1];
-      node->data[1] = node->data[2];
-      node->len--;
-    }
-    else if (node->len == 2 && node->data[1].first == k)
-    {
-      node->data[1] = node->data[2];
-      node->len--;
+      if (node->key(i) == k)
+      {
+        for (; i + 1 < node->len; ++i)
+        {
+          node->data[i] = std::move(node->data[i + 1]);
+        }
+        node->pop_back();
+        return;
+      }
     }
   }
 
@@ -509,9 +528,8 @@ namespace savintsev
       root = new node_type{};
       for (size_t i = 0; i < other->len; ++i)
       {
-        root->data[i] = other->data[i];
+        root->emplace_back(other->data[i]);
       }
-      root->len = other->len;
       for (size_t i = 0; i < 3; ++i)
       {
         if (other->kids[i])
@@ -626,13 +644,13 @@ namespace savintsev
         {
           parent->kids[0]->kids[0]->father = parent->kids[0];
         }
-        remove_data_from_node(parent, parent->data[0]);
+        remove_data_from_node(parent, parent->key(0));
         delete first;
       }
       else if (second == leaf)
       {
         insert_data_in_node(first, parent->data[0]);
-        remove_data_from_node(parent, parent->data[0]);
+        remove_data_from_node(parent, parent->key(0));
         if (leaf->kids[0])
         {
           first->kids[2] = leaf->kids[0];
@@ -654,7 +672,7 @@ namespace savintsev
       {
         insert_data_in_node(second, parent->data[1]);
         parent->kids[2] = nullptr;
-        remove_data_from_node(parent, parent->data[1]);
+        remove_data_from_node(parent, parent->key(1));
         if (leaf->kids[0])
         {
           second->kids[2] = leaf->kids[0];
@@ -684,7 +702,7 @@ namespace savintsev
         if (second->len == 2)
         {
           parent->data[1] = second->data[1];
-          remove_data_from_node(second, second->data[1]);
+          remove_data_from_node(second, second->key(1));
           leaf->kids[0] = second->kids[2];
           second->kids[2] = nullptr;
           if (leaf->kids[0])
@@ -703,7 +721,7 @@ namespace savintsev
           }
           second->data[0] = parent->data[0];
           parent->data[0] = first->data[1];
-          remove_data_from_node(first, first->data[1]);
+          remove_data_from_node(first, first->key(1));
           second->kids[0] = first->kids[2];
           if (second->kids[0])
           {
@@ -723,7 +741,7 @@ namespace savintsev
           }
           insert_data_in_node(second, parent->data[1]);
           parent->data[1] = third->data[0];
-          remove_data_from_node(third, third->data[0]);
+          remove_data_from_node(third, third->key(0));
           second->kids[1] = third->kids[0];
           if (second->kids[1])
           {
@@ -742,7 +760,7 @@ namespace savintsev
           }
           insert_data_in_node(second, parent->data[0]);
           parent->data[0] = first->data[1];
-          remove_data_from_node(first, first->data[1]);
+          remove_data_from_node(first, first->key(1));
           second->kids[0] = first->kids[2];
           if (second->kids[0])
           {
@@ -762,7 +780,7 @@ namespace savintsev
         if (second->len == 2)
         {
           parent->data[0] = second->data[0];
-          remove_data_from_node(second, second->data[0]);
+          remove_data_from_node(second, second->key(0));
           first->kids[1] = second->kids[0];
           if (first->kids[1])
           {
@@ -777,7 +795,7 @@ namespace savintsev
           parent->data[0] = second->data[0];
           second->data[0] = parent->data[1];
           parent->data[1] = third->data[0];
-          remove_data_from_node(third, third->data[0]);
+          remove_data_from_node(third, third->key(0));
           first->kids[1] = second->kids[0];
           if (first->kids[1])
           {
@@ -802,7 +820,7 @@ namespace savintsev
       if (first == leaf && second->len == 2)
       {
         parent->data[0] = second->data[0];
-        remove_data_from_node(second, second->data[0]);
+        remove_data_from_node(second, second->key(0));
 
         if (leaf->kids[0] == nullptr)
         {
@@ -820,7 +838,7 @@ namespace savintsev
       else if (second == leaf && first->len == 2)
       {
         parent->data[0] = first->data[1];
-        remove_data_from_node(first, first->data[1]);
+        remove_data_from_node(first, first->key(1));
 
         if (leaf->kids[1] == nullptr)
         {
@@ -860,7 +878,7 @@ namespace savintsev
       {
         parent->kids[1]->kids[0]->father = parent->kids[1];
       }
-      remove_data_from_node(parent, parent->data[0]);
+      remove_data_from_node(parent, parent->key(0));
       delete parent->kids[0];
       parent->kids[0] = nullptr;
     }
@@ -881,7 +899,7 @@ namespace savintsev
       {
         parent->kids[0]->kids[2]->father = parent->kids[0];
       }
-      remove_data_from_node(parent, parent->data[0]);
+      remove_data_from_node(parent, parent->key(0));
       delete parent->kids[1];
       parent->kids[1] = nullptr;
     }
@@ -918,8 +936,9 @@ namespace savintsev
       closest = search_min(target->kids[position.pos_ + 1]);
     }
 
-    const key_type k = position->first;
-    const key_type k_next = (++position)->first;
+    const key_type k = position.node_->key(position.pos_);
+    ++position;
+    const key_type k_next = position.node_->key(position.pos_);
     if (closest)
     {
       std::swap(target->data[position.pos_], closest->data[0]);
@@ -1030,14 +1049,14 @@ namespace savintsev
       }
     }
 
-    insert_data_in_node(left, node->data[0]);
+    insert_data_in_node(left, std::move_if_noexcept(node->data[0]));
     try
     {
-      insert_data_in_node(right, node->data[2]);
+      insert_data_in_node(right, std::move_if_noexcept(node->data[2]));
     }
     catch (...)
     {
-      remove_data_from_node(left, node->data[0]);
+      remove_data_from_node(left, node->key(0));
       throw;
     }
 
@@ -1047,7 +1066,7 @@ namespace savintsev
       {
         node_type * parent = node->father;
 
-        insert_data_in_node(parent, node->data[1]);
+        insert_data_in_node(parent, std::move_if_noexcept(node->data[1]));
 
         if (parent->kids[0] == node)
         {
@@ -1075,19 +1094,20 @@ namespace savintsev
       {
         left->father = node;
         right->father = node;
-        node->data[0] = node->data[1];
+        node->data[0] = std::move(node->data[1]);
+        node->pop_back();
+        node->pop_back();
         node->kids[0] = left;
         node->kids[1] = right;
         node->kids[2] = nullptr;
         node->kids[3] = nullptr;
-        node->len = 1;
         return node;
       }
     }
     catch (...)
     {
-      remove_data_from_node(left, node->data[0]);
-      remove_data_from_node(right, node->data[2]);
+      remove_data_from_node(left, node->key(0));
+      remove_data_from_node(right, node->key(2));
       throw;
     }
   }
@@ -1100,13 +1120,77 @@ namespace savintsev
   >
   TwoThreeTree< K, V, C >::insert(const value_type & val)
   {
-    auto result = lazy_find(val.first);
+    auto result = lazy_find(node_type::traits::key(val));
     if (result.second)
     {
       return {result.first, false};
     }
     return insert_node(result.first.node_, val);
   }
+
+  template< typename K, typename V, typename C >
+  std::pair
+  <
+    typename TwoThreeTree< K, V, C >::iterator,
+    bool
+  >
+  TwoThreeTree< K, V, C >::insert(value_type && val)
+  {
+    auto result = lazy_find(node_type::traits::key(val));
+    if (result.second)
+    {
+      return {result.first, false};
+    }
+    return insert_node(result.first.node_, std::move(val));
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  std::pair
+  <
+    typename TwoThreeTree< K, V, C >::iterator,
+    bool
+  >
+  TwoThreeTree< K, V, C >::emplace(Args &&... args)
+  {
+    return insert(value_type(std::forward< Args >(args)...));
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  std::pair
+  <
+    typename TwoThreeTree< K, V, C >::iterator,
+    bool
+  >
+  TwoThreeTree< K, V, C >::try_emplace(const key_type & k, Args &&... args)
+  {
+    auto result = lazy_find(k);
+    if (result.second)
+    {
+      return {result.first, false};
+    }
+    return insert_node(result.first.node_, std::piecewise_construct, std::forward_as_tuple(k),
+      std::forward_as_tuple(std::forward< Args >(args)...));
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  std::pair
+  <
+    typename TwoThreeTree< K, V, C >::iterator,
+    bool
+  >
+  TwoThreeTree< K, V, C >::try_emplace(key_type && k, Args &&... args)
+  {
+    auto result = lazy_find(k);
+    if (result.second)
+    {
+      return {result.first, false};
+    }
+    return insert_node(result.first.node_, std::piecewise_construct, std::forward_as_tuple(std::move(k)),
+      std::forward_as_tuple(std::forward< Args >(args)...));
+  }
 }
 
 #endif
@@ -19,11 +19,11 @@ namespace savintsev
     friend class TwoThreeTree;
   public:
     using iterator_category = std::bidirectional_iterator_tag;
-    using value_type = std::pair< Key, Value >;
+    using value_type = typename ttt_traits< Key, Value >::value_type;
     using difference_type = std::ptrdiff_t;
     using pointer = const value_type *;
     using reference = const value_type &;
-    using node_type = node_t< value_type >;
+    using node_type = node_t< Key, Value >;
 
     BidirectConstIterator() = default;
     BidirectConstIterator(const BidirectIterator< Key, Value > & it);
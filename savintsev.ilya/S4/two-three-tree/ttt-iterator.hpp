@@ -20,11 +20,11 @@ namespace savintsev
     friend class BidirectConstIterator< Key, Value >;
   public:
     using iterator_category = std::bidirectional_iterator_tag;
-    using value_type = std::pair< Key, Value >;
+    using value_type = typename ttt_traits< Key, Value >::value_type;
     using difference_type = std::ptrdiff_t;
     using pointer = value_type *;
     using reference = value_type &;
-    using node_type = node_t< value_type >;
+    using node_type = node_t< Key, Value >;
 
     BidirectIterator() = default;
     reference operator*();
@@ -1,18 +1,87 @@
 #ifndef TTT_NODE_H
 #define TTT_NODE_H
 #include <cstddef>
+#include <new>
+#include <utility>
 
 namespace savintsev
 {
+  template< typename Key, typename Value >
+  struct ttt_traits
+  {
+    using value_type = std::pair< Key, Value >;
+    using mapped_type = Value;
+
+    static const Key & key(const value_type & val) noexcept
+    {
+      return val.first;
+    }
+  };
+
+  template< typename Key >
+  struct ttt_traits< Key, void >
+  {
+    using value_type = Key;
+    // named only by the map members, which a set never instantiates
+    using mapped_type = Key;
+
+    static const Key & key(const value_type & val) noexcept
+    {
+      return val;
+    }
+  };
+
   template< typename T >
+  struct slots_t
+  {
+    alignas(T) unsigned char raw[3 * sizeof(T)];
+
+    T & operator[](size_t i) noexcept
+    {
+      return reinterpret_cast< T * >(raw)[i];
+    }
+    const T & operator[](size_t i) const noexcept
+    {
+      return reinterpret_cast< const T * >(raw)[i];
+    }
+  };
+
+  template< typename Key, typename Value >
   struct node_t
   {
-    T data[3];
+    using traits = ttt_traits< Key, Value >;
+    using value_type = typename traits::value_type;
+
+    slots_t< value_type > data;
 
     node_t * kids[4] = {nullptr, nullptr, nullptr, nullptr};
     node_t * father = nullptr;
 
     size_t len = 0;
+
+    ~node_t()
+    {
+      while (len > 0)
+      {
+        pop_back();
+      }
+    }
+
+    const Key & key(size_t i) const noexcept
+    {
+      return traits::key(data[i]);
+    }
+
+    template< typename... Args >
+    void emplace_back(Args &&... args)
+    {
+      new (std::addressof(data[len])) value_type(std::forward< Args >(args)...);
+      len++;
+    }
+    void pop_back() noexcept
+    {
+      data[--len].~value_type();
+    }
   };
 }
 
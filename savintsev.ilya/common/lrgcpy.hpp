@@ -1,24 +1,92 @@
 #ifndef LRGCPY_HPP
 #define LRGCPY_HPP
 #include <cstddef>
+#include <cstring>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace savintsev
 {
   template< typename T >
-  T * createExpandCopy(const T * old, size_t old_size, size_t new_size)
+  T * allocateRaw(size_t n)
+  {
+    return n ? static_cast< T * >(::operator new(n * sizeof(T))) : nullptr;
+  }
+
+  template< typename T >
+  void destroyRange(T * first, size_t n) noexcept
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      first[i].~T();
+    }
+  }
+
+  template< typename T >
+  void copyConstruct(T * dest, const T * src, size_t n, std::true_type) noexcept
+  {
+    if (n)
+    {
+      std::memcpy(dest, src, n * sizeof(T));
+    }
+  }
+
+  template< typename T >
+  void copyConstruct(T * dest, const T * src, size_t n, std::false_type)
+  {
+    size_t i = 0;
+    try
+    {
+      for (; i < n; ++i)
+      {
+        new (dest + i) T(src[i]);
+      }
+    }
+    catch (...)
+    {
+      destroyRange(dest, i);
+      throw;
+    }
+  }
+
+  template< typename T >
+  void relocate(T * dest, T * src, size_t n, std::true_type) noexcept
+  {
+    copyConstruct(dest, src, n, std::true_type{});
+  }
+
+  template< typename T >
+  void relocate(T * dest, T * src, size_t n, std::false_type)
   {
-    T * created = new T[new_size];
+    size_t i = 0;
     try
     {
-      for (size_t i = 0; i < old_size; ++i)
+      for (; i < n; ++i)
       {
-        created[i] = old[i];
+        new (dest + i) T(std::move_if_noexcept(src[i]));
       }
     }
     catch (...)
     {
-      delete[] created;
+      destroyRange(dest, i);
+      throw;
+    }
+    destroyRange(src, n);
+  }
+
+  template< typename T >
+  T * createExpandCopy(const T * old, size_t old_size, size_t new_size)
+  {
+    T * created = allocateRaw< T >(new_size);
+    try
+    {
+      copyConstruct(created, old, old_size, std::is_trivially_copyable< T >{});
+    }
+    catch (...)
+    {
+      ::operator delete(created);
       throw;
     }
     return created;
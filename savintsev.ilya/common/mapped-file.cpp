@@ -0,0 +1,202 @@
+#include "mapped-file.hpp"
+#include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+  bool isSpace(char c) noexcept
+  {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+  }
+
+  bool isDigit(char c) noexcept
+  {
+    return c >= '0' && c <= '9';
+  }
+}
+
+namespace savintsev
+{
+  std::string StrView::str() const
+  {
+    return std::string(data, size);
+  }
+
+  MappedFile::MappedFile(const char * filename)
+  {
+    int fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return;
+    }
+    open_ = true;
+    struct stat info;
+    bool regular = ::fstat(fd, &info) == 0 && S_ISREG(info.st_mode);
+    if (regular && info.st_size > 0)
+    {
+      void * mapping = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED)
+      {
+        ::madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+        data_ = static_cast< char * >(mapping);
+        size_ = info.st_size;
+        mapped_ = true;
+      }
+    }
+    if (!mapped_)
+    {
+      try
+      {
+        readAll(fd);
+      }
+      catch (...)
+      {
+        ::close(fd);
+        throw;
+      }
+    }
+    ::close(fd);
+  }
+
+  MappedFile::~MappedFile()
+  {
+    if (mapped_)
+    {
+      ::munmap(data_, size_);
+    }
+  }
+
+  bool MappedFile::is_open() const noexcept
+  {
+    return open_;
+  }
+
+  const char * MappedFile::begin() const noexcept
+  {
+    return data_;
+  }
+
+  const char * MappedFile::end() const noexcept
+  {
+    return data_ + size_;
+  }
+
+  void MappedFile::readAll(int fd)
+  {
+    buffer_.resize(4096);
+    ssize_t count = 0;
+    while ((count = ::read(fd, &buffer_[size_], buffer_.size() - size_)) > 0)
+    {
+      size_ += count;
+      if (size_ == buffer_.size())
+      {
+        buffer_.resize(size_ * 2);
+      }
+    }
+    data_ = &buffer_[0];
+  }
+
+  TokenReader::TokenReader(const char * first, const char * last) noexcept:
+    pos_(first),
+    last_(last)
+  {}
+
+  TokenReader::operator bool() const noexcept
+  {
+    return !fail_;
+  }
+
+  int TokenReader::peek() noexcept
+  {
+    if (eof_ || fail_)
+    {
+      fail_ = true;
+      return std::char_traits< char >::eof();
+    }
+    if (pos_ == last_)
+    {
+      eof_ = true;
+      return std::char_traits< char >::eof();
+    }
+    return std::char_traits< char >::to_int_type(*pos_);
+  }
+
+  void TokenReader::clear() noexcept
+  {
+    eof_ = false;
+    fail_ = false;
+  }
+
+  TokenReader & TokenReader::operator>>(StrView & word) noexcept
+  {
+    if (!skipSpaces())
+    {
+      return *this;
+    }
+    const char * first = pos_;
+    while (pos_ != last_ && !isSpace(*pos_))
+    {
+      ++pos_;
+    }
+    eof_ = (pos_ == last_);
+    word = {first, static_cast< size_t >(pos_ - first)};
+    return *this;
+  }
+
+  TokenReader & TokenReader::operator>>(int & value) noexcept
+  {
+    if (!skipSpaces())
+    {
+      return *this;
+    }
+    bool negative = (*pos_ == '-');
+    if (negative || *pos_ == '+')
+    {
+      ++pos_;
+    }
+    const unsigned long long max = std::numeric_limits< int >::max() + 1ull * negative;
+    unsigned long long result = 0;
+    bool overflow = false;
+    const char * digits = pos_;
+    for (; pos_ != last_ && isDigit(*pos_); ++pos_)
+    {
+      unsigned long long digit = *pos_ - '0';
+      overflow = overflow || result > (max - digit) / 10;
+      result = overflow ? result : result * 10 + digit;
+    }
+    eof_ = (pos_ == last_);
+    if (pos_ == digits || overflow)
+    {
+      fail_ = true;
+    }
+    else
+    {
+      long long signed_result = static_cast< long long >(result);
+      value = static_cast< int >(negative ? -signed_result : signed_result);
+    }
+    return *this;
+  }
+
+  bool TokenReader::skipSpaces() noexcept
+  {
+    if (eof_ || fail_)
+    {
+      fail_ = true;
+      return false;
+    }
+    while (pos_ != last_ && isSpace(*pos_))
+    {
+      ++pos_;
+    }
+    if (pos_ == last_)
+    {
+      eof_ = true;
+      fail_ = true;
+      return false;
+    }
+    return true;
+  }
+}
@@ -0,0 +1,59 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+#include <cstddef>
+#include <string>
+
+namespace savintsev
+{
+  struct StrView
+  {
+    const char * data;
+    size_t size;
+
+    std::string str() const;
+  };
+
+  class MappedFile
+  {
+  public:
+    explicit MappedFile(const char * filename);
+    MappedFile(const MappedFile & rhs) = delete;
+    ~MappedFile();
+
+    MappedFile & operator=(const MappedFile & rhs) = delete;
+
+    bool is_open() const noexcept;
+    const char * begin() const noexcept;
+    const char * end() const noexcept;
+  private:
+    char * data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    bool open_ = false;
+    std::string buffer_;
+
+    void readAll(int fd);
+  };
+
+  class TokenReader
+  {
+  public:
+    TokenReader(const char * first, const char * last) noexcept;
+
+    explicit operator bool() const noexcept;
+    int peek() noexcept;
+    void clear() noexcept;
+
+    TokenReader & operator>>(StrView & word) noexcept;
+    TokenReader & operator>>(int & value) noexcept;
+  private:
+    const char * pos_;
+    const char * last_;
+    bool eof_ = false;
+    bool fail_ = false;
+
+    bool skipSpaces() noexcept;
+  };
+}
+
+#endif
@@ -32,6 +32,14 @@ namespace tkach
     Iterator< Key, Value, Cmp > find(const Key& key);
     Value& at(const Key& key);
     const Value& at(const Key& key) const;
+    template< class K, class C = Cmp, class = typename C::is_transparent >
+    Citerator< Key, Value, Cmp > find(const K& key) const;
+    template< class K, class C = Cmp, class = typename C::is_transparent >
+    Iterator< Key, Value, Cmp > find(const K& key);
+    template< class K, class C = Cmp, class = typename C::is_transparent >
+    Value& at(const K& key);
+    template< class K, class C = Cmp, class = typename C::is_transparent >
+    const Value& at(const K& key) const;
     Citerator< Key, Value, Cmp > cbegin() const;
     Iterator< Key, Value, Cmp > begin();
     Citerator< Key, Value, Cmp > cend() const;
@@ -49,25 +57,36 @@ namespace tkach
     bool empty() const noexcept;
     size_t size() const noexcept;
     size_t count(const Key& k) const;
+    template< class K, class C = Cmp, class = typename C::is_transparent >
+    size_t count(const K& k) const;
+    Iterator< Key, Value, Cmp > nth(size_t index);
+    Citerator< Key, Value, Cmp > nth(size_t index) const;
+    size_t rank(const Key& key) const;
+    size_t distance(Citerator< Key, Value, Cmp > first, Citerator< Key, Value, Cmp > last) const;
+    size_t distance(Iterator< Key, Value, Cmp > first, Iterator< Key, Value, Cmp > last) const;
   private:
-    using pair_t = std::pair< tkach::TreeNode< Key, Value >*, tkach::TreeNode< Key, Value >* >;
     TreeNode< Key, Value >* root_;
     size_t size_;
     Cmp cmp_;
     template< class... Args >
     Iterator< Key, Value, Cmp > insertSingle(const Key& key, Args&&... args);
     void clearFrom(TreeNode< Key, Value >* node);
+    template< class K >
+    TreeNode< Key, Value >* findNode(const K& key) const;
     TreeNode< Key, Value >* findMin(TreeNode< Key, Value >* node) const;
     TreeNode< Key, Value >* findMax(TreeNode< Key, Value >* node) const;
     TreeNode< Key, Value >* rotateLeft(TreeNode< Key, Value >* const root);
     TreeNode< Key, Value >* rotateRight(TreeNode< Key, Value >* const root);
     void fixHeight(TreeNode< Key, Value >* node);
-    size_t height(TreeNode< Key, Value >* node);
+    int height(const TreeNode< Key, Value >* node) const;
+    void fixSize(TreeNode< Key, Value >* node);
+    size_t subtreeSize(const TreeNode< Key, Value >* node) const;
+    size_t position(const TreeNode< Key, Value >* node) const;
     void swap(AvlTree< Key, Value, Cmp >& other) noexcept;
-    TreeNode< Key, Value >* eraseFrom(TreeNode< Key, Value >* root, const Key& key);
+    void eraseNode(TreeNode< Key, Value >* node);
+    void replaceChild(TreeNode< Key, Value >* parent, TreeNode< Key, Value >* old_child, TreeNode< Key, Value >* new_child);
+    void rebalanceUp(TreeNode< Key, Value >* node);
     TreeNode< Key, Value >* balance(TreeNode< Key, Value >* root);
-    template< class... Args >
-    pair_t insertCmp(TreeNode< Key, Value >* root, const Key& key, Args&&... args);
   };
 
   template< class Key, class Value, class Cmp >
@@ -201,42 +220,83 @@ namespace tkach
   }
 
   template< class Key, class Value, class Cmp >
-  TreeNode< Key, Value >* AvlTree< Key, Value, Cmp >::eraseFrom(TreeNode< Key, Value >* root, const Key& key)
+  void AvlTree< Key, Value, Cmp >::replaceChild(TreeNode< Key, Value >* parent, TreeNode< Key, Value >* old_child,
+    TreeNode< Key, Value >* new_child)
   {
-    if (!root)
+    if (parent == nullptr)
     {
-      return nullptr;
+      root_ = new_child;
     }
-    if (cmp_(key, root->data.first))
+    else if (parent->left == old_child)
     {
-      root->left = eraseFrom(root->left, key);
+      parent->left = new_child;
     }
-    else if (cmp_(root->data.first, key))
+    else
     {
-      root->right = eraseFrom(root->right, key);
+      parent->right = new_child;
     }
-    else
+    if (new_child != nullptr)
     {
-      if (root->left != nullptr)
+      new_child->parent = parent;
+    }
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::eraseNode(TreeNode< Key, Value >* node)
+  {
+    TreeNode< Key, Value >* fix_from = node->parent;
+    if (node->left != nullptr && node->right != nullptr)
+    {
+      TreeNode< Key, Value >* max_tree = findMax(node->left);
+      if (max_tree->parent == node)
       {
-        TreeNode< Key, Value >* max_tree = findMax(root->left);
-        root->data = max_tree->data;
-        root->left = eraseFrom(root->left, max_tree->data.first);
+        fix_from = max_tree;
       }
-      else if (root->right != nullptr)
+      else
       {
-        TreeNode< Key, Value >* min_tree = findMin(root->right);
-        root->data = min_tree->data;
-        root->right = eraseFrom(root->right, min_tree->data.first);
+        fix_from = max_tree->parent;
+        replaceChild(max_tree->parent, max_tree, max_tree->left);
+        max_tree->left = node->left;
+        max_tree->left->parent = max_tree;
       }
-      else
+      max_tree->right = node->right;
+      max_tree->right->parent = max_tree;
+      max_tree->height = node->height;
+      replaceChild(node->parent, node, max_tree);
+    }
+    else
+    {
+      replaceChild(node->parent, node, node->left != nullptr ? node->left : node->right);
+    }
+    delete node;
+    size_--;
+    rebalanceUp(fix_from);
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::rebalanceUp(TreeNode< Key, Value >* node)
+  {
+    while (node != nullptr)
+    {
+      int old_height = node->height;
+      TreeNode< Key, Value >* parent = node->parent;
+      fixHeight(node);
+      fixSize(node);
+      TreeNode< Key, Value >* balanced = balance(node);
+      if (parent == nullptr)
       {
-        delete root;
-        return nullptr;
+        root_ = balanced;
+      }
+      node = parent;
+      if (balanced->height == old_height)
+      {
+        break;
       }
     }
-    fixHeight(root);
-    return balance(root);
+    for (; node != nullptr; node = node->parent)
+    {
+      fixSize(node);
+    }
   }
 
   template< class Key, class Value, class Cmp >
@@ -259,13 +319,11 @@ namespace tkach
   template< class Key, class Value, class Cmp >
   Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::erase(Iterator< Key, Value, Cmp > begin, Iterator< Key, Value, Cmp > end)
   {
-    Iterator< Key, Value, Cmp > res;
     while (begin != end)
     {
-      res = erase(begin->first);
-      begin++;
+      begin = erase(begin);
     }
-    return res;
+    return end;
   }
 
   template< class Key, class Value, class Cmp >
@@ -291,8 +349,7 @@ namespace tkach
   {
     auto it2 = it;
     it2++;
-    root_ = eraseFrom(root_, it->first);
-    size_--;
+    eraseNode(it.node_);
     return it2;
   }
 
@@ -300,11 +357,11 @@ namespace tkach
   Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::erase(const Key& key)
   {
     auto it = find(key);
-    auto it2 = it;
-    it2++;
-    root_ = eraseFrom(root_, key);
-    size_--;
-    return it2;
+    if (it == end())
+    {
+      return it;
+    }
+    return erase(it);
   }
 
   template< class Key, class Value, class Cmp >
@@ -329,11 +386,103 @@ namespace tkach
   }
 
   template< class Key, class Value, class Cmp >
-  size_t AvlTree< Key, Value, Cmp >::height(TreeNode< Key, Value >* node)
+  int AvlTree< Key, Value, Cmp >::height(const TreeNode< Key, Value >* node) const
   {
     return node ? node->height : 0;
   }
 
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::fixSize(TreeNode< Key, Value >* node)
+  {
+    node->subtree_size = 1 + subtreeSize(node->left) + subtreeSize(node->right);
+  }
+
+  template< class Key, class Value, class Cmp >
+  size_t AvlTree< Key, Value, Cmp >::subtreeSize(const TreeNode< Key, Value >* node) const
+  {
+    return node ? node->subtree_size : 0;
+  }
+
+  template< class Key, class Value, class Cmp >
+  size_t AvlTree< Key, Value, Cmp >::position(const TreeNode< Key, Value >* node) const
+  {
+    if (node == nullptr)
+    {
+      return subtreeSize(root_);
+    }
+    size_t result = subtreeSize(node->left);
+    for (; node->parent != nullptr; node = node->parent)
+    {
+      if (node->parent->right == node)
+      {
+        result += subtreeSize(node->parent->left) + 1;
+      }
+    }
+    return result;
+  }
+
+  template< class Key, class Value, class Cmp >
+  Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::nth(size_t index)
+  {
+    return Iterator< Key, Value, Cmp >((static_cast< const AvlTree< Key, Value, Cmp >* >(this)->nth(index)).node_);
+  }
+
+  template< class Key, class Value, class Cmp >
+  Citerator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::nth(size_t index) const
+  {
+    TreeNode< Key, Value >* node = root_;
+    while (node)
+    {
+      size_t left_size = subtreeSize(node->left);
+      if (index < left_size)
+      {
+        node = node->left;
+      }
+      else if (index == left_size)
+      {
+        break;
+      }
+      else
+      {
+        index -= left_size + 1;
+        node = node->right;
+      }
+    }
+    return Citerator< Key, Value, Cmp >(node);
+  }
+
+  template< class Key, class Value, class Cmp >
+  size_t AvlTree< Key, Value, Cmp >::rank(const Key& key) const
+  {
+    const TreeNode< Key, Value >* node = root_;
+    size_t result = 0;
+    while (node)
+    {
+      if (cmp_(node->data.first, key))
+      {
+        result += subtreeSize(node->left) + 1;
+        node = node->right;
+      }
+      else
+      {
+        node = node->left;
+      }
+    }
+    return result;
+  }
+
+  template< class Key, class Value, class Cmp >
+  size_t AvlTree< Key, Value, Cmp >::distance(Citerator< Key, Value, Cmp > first, Citerator< Key, Value, Cmp > last) const
+  {
+    return position(last.node_) - position(first.node_);
+  }
+
+  template< class Key, class Value, class Cmp >
+  size_t AvlTree< Key, Value, Cmp >::distance(Iterator< Key, Value, Cmp > first, Iterator< Key, Value, Cmp > last) const
+  {
+    return position(last.node_) - position(first.node_);
+  }
+
   template< class Key, class Value, class Cmp >
   TreeNode< Key, Value >* AvlTree< Key, Value, Cmp >::rotateLeft(TreeNode< Key, Value >* const root)
   {
@@ -363,6 +512,8 @@ namespace tkach
     root->parent = rotate_tree;
     fixHeight(root);
     fixHeight(rotate_tree);
+    fixSize(root);
+    fixSize(rotate_tree);
     return rotate_tree;
   }
 
@@ -395,6 +546,8 @@ namespace tkach
     root->parent = rotate_tree;
     fixHeight(root);
     fixHeight(rotate_tree);
+    fixSize(root);
+    fixSize(rotate_tree);
     return rotate_tree;
   }
 
@@ -459,6 +612,25 @@ namespace tkach
     throw std::out_of_range("<INVALID COMMAND>");
   }
 
+  template< class Key, class Value, class Cmp >
+  template< class K, class C, class >
+  Value& AvlTree< Key, Value, Cmp >::at(const K& key)
+  {
+    return const_cast< Value& >(static_cast< const AvlTree< Key, Value, Cmp >* >(this)->at(key));
+  }
+
+  template< class Key, class Value, class Cmp >
+  template< class K, class C, class >
+  const Value& AvlTree< Key, Value, Cmp >::at(const K& key) const
+  {
+    Citerator< Key, Value, Cmp > node = find(key);
+    if (node != cend())
+    {
+      return node->second;
+    }
+    throw std::out_of_range("<INVALID COMMAND>");
+  }
+
   template< class Key, class Value, class Cmp >
   Value& AvlTree< Key, Value, Cmp >::operator[](const Key& key)
   {
@@ -489,10 +661,36 @@ namespace tkach
   template< class... Args >
   Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::insertSingle(const Key& key, Args&&... args)
   {
-    auto pair = insertCmp(root_, key, std::forward< Args >(args)...);
-    root_ = pair.first;
+    TreeNode< Key, Value >* parent = nullptr;
+    TreeNode< Key, Value >* root = root_;
+    bool to_left = false;
+    while (root != nullptr)
+    {
+      parent = root;
+      to_left = cmp_(key, root->data.first);
+      if (!to_left && !cmp_(root->data.first, key))
+      {
+        return Iterator< Key, Value, Cmp >(root);
+      }
+      root = to_left ? root->left : root->right;
+    }
+    TreeNode< Key, Value >* new_node = new TreeNode< Key, Value >(std::forward< Args >(args)...);
+    new_node->parent = parent;
+    if (parent == nullptr)
+    {
+      root_ = new_node;
+    }
+    else if (to_left)
+    {
+      parent->left = new_node;
+    }
+    else
+    {
+      parent->right = new_node;
+    }
     size_++;
-    return Iterator< Key, Value >(pair.second);
+    rebalanceUp(parent);
+    return Iterator< Key, Value, Cmp >(new_node);
   }
 
   template< class Key, class Value, class Cmp >
@@ -519,91 +717,65 @@ namespace tkach
   }
 
   template< class Key, class Value, class Cmp >
-  template< class... Args >
-  auto AvlTree< Key, Value, Cmp >::insertCmp(TreeNode< Key, Value >* root, const Key& key, Args&&... args) -> pair_t
+  size_t AvlTree< Key, Value, Cmp >::count(const Key& k) const
   {
-    TreeNode< Key, Value >* inserted = nullptr;
-    if (root == nullptr)
-    {
-      TreeNode< Key, Value >* new_node = new TreeNode< Key, Value >(std::forward< Args >(args)...);
-      return std::make_pair(new_node, new_node);
-    }
-    else if (cmp_(key, root->data.first))
-    {
-      auto pair = insertCmp(root->left, key, std::forward< Args >(args)...);
-      root->left = pair.first;
-      inserted = pair.second;
-      if (root->left->parent == nullptr)
-      {
-        root->left->parent = root;
-      }
-    }
-    else if (cmp_(root->data.first, key))
-    {
-      auto pair = insertCmp(root->right, key, std::forward< Args >(args)...);
-      root->right = pair.first;
-      inserted = pair.second;
-      if (root->right->parent == nullptr)
-      {
-        root->right->parent = root;
-      }
-    }
-    else
-    {
-      return std::make_pair(root, root);
-    }
-    fixHeight(root);
-    return std::make_pair(balance(root), inserted);
+    return findNode(k) != nullptr;
   }
 
   template< class Key, class Value, class Cmp >
-  size_t AvlTree< Key, Value, Cmp >::count(const Key& k) const
+  template< class K, class C, class >
+  size_t AvlTree< Key, Value, Cmp >::count(const K& k) const
   {
-    size_t count = 0;
-    for (auto it = cbegin(); it != cend(); ++it)
-    {
-      if (!cmp_(k, it->first) && !cmp_(it->first, k))
-      {
-        ++count;
-      }
-    }
-    return count;
+    return findNode(k) != nullptr;
   }
 
   template< class Key, class Value, class Cmp >
   Citerator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::find(const Key& key) const
   {
-    TreeNode< Key, Value >* root = root_;
-    while (root != nullptr && key != root->data.first)
-    {
-      if (cmp_(key, root->data.first))
-      {
-        root = root->left;
-      }
-      else
-      {
-        root = root->right;
-      }
-    }
-    return Citerator< Key, Value, Cmp >(root);
+    return Citerator< Key, Value, Cmp >(findNode(key));
   }
 
   template< class Key, class Value, class Cmp >
   Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::find(const Key& key)
+  {
+    return Iterator< Key, Value, Cmp >(findNode(key));
+  }
+
+  template< class Key, class Value, class Cmp >
+  template< class K, class C, class >
+  Citerator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::find(const K& key) const
+  {
+    return Citerator< Key, Value, Cmp >(findNode(key));
+  }
+
+  template< class Key, class Value, class Cmp >
+  template< class K, class C, class >
+  Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::find(const K& key)
+  {
+    return Iterator< Key, Value, Cmp >(findNode(key));
+  }
+
+  template< class Key, class Value, class Cmp >
+  template< class K >
+  TreeNode< Key, Value >* AvlTree< Key, Value, Cmp >::findNode(const K& key) const
   {
     TreeNode< Key, Value >* root = root_;
-    while (root != nullptr && key != root->data.first)
+    while (root != nullptr)
     {
       if (cmp_(key, root->data.first))
       {
         root = root->left;
       }
-      else
+      else if (cmp_(root->data.first, key))
       {
         root = root->right;
       }
+      else
+      {
+        break;
+      }
     }
-    return Iterator< Key, Value, Cmp >(root);
+    return root;
   }
 
   template< class Key, class Value, class Cmp >
@@ -616,12 +788,22 @@ namespace tkach
   template< class Key, class Value, class Cmp >
   void AvlTree< Key, Value, Cmp >::clearFrom(TreeNode< Key, Value >* root)
   {
-    if (root)
+    while (root != nullptr)
     {
-      size_--;
-      clearFrom(root->left);
-      clearFrom(root->right);
-      delete root;
+      if (root->left != nullptr)
+      {
+        TreeNode< Key, Value >* left = root->left;
+        root->left = left->right;
+        left->right = root;
+        root = left;
+      }
+      else
+      {
+        TreeNode< Key, Value >* right = root->right;
+        delete root;
+        size_--;
+        root = right;
+      }
     }
   }
 }
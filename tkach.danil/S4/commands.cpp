@@ -1,11 +1,11 @@
 #include "commands.hpp"
 #include <cstddef>
 
-void tkach::print(std::istream& in, const AvlTree< std::string, AvlTree< size_t, std::string > >& avltree, std::ostream& out)
+void tkach::print(std::istream& in, const DataSets& avltree, std::ostream& out)
 {
   std::string name;
   in >> name;
-  AvlTree< size_t, std::string > root = avltree.at(name);
+  const AvlTree< size_t, std::string >& root = avltree.at(name);
   if (root.empty())
   {
     out << "<EMPTY>\n";
@@ -21,15 +21,15 @@ void tkach::print(std::istream& in, const AvlTree< std::string, AvlTree< size_t,
   }
 }
 
-void tkach::intersect(std::istream& in, AvlTree< std::string, AvlTree< size_t, std::string > >& avltree)
+void tkach::intersect(std::istream& in, DataSets& avltree)
 {
   std::string new_name;
   std::string first_name;
   std::string last_name;
   in >> new_name >> first_name >> last_name;
   AvlTree< size_t, std::string > root;
-  const AvlTree< size_t, std::string > first = avltree.at(first_name);
-  const AvlTree< size_t, std::string > second = avltree.at(last_name);
+  const AvlTree< size_t, std::string >& first = avltree.at(first_name);
+  const AvlTree< size_t, std::string >& second = avltree.at(last_name);
   for (auto it = first.cbegin(); it != first.cend(); ++it)
   {
     if (second.find(it->first) != second.cend())
@@ -47,15 +47,15 @@ void tkach::intersect(std::istream& in, AvlTree< std::string, AvlTree< size_t, s
   }
 }
 
-void tkach::complement(std::istream& in, AvlTree< std::string, AvlTree< size_t, std::string > >& avltree)
+void tkach::complement(std::istream& in, DataSets& avltree)
 {
   std::string new_name;
   std::string first_name;
   std::string last_name;
   in >> new_name >> first_name >> last_name;
   AvlTree< size_t, std::string > root;
-  const AvlTree< size_t, std::string > first = avltree.at(first_name);
-  const AvlTree< size_t, std::string > second = avltree.at(last_name);
+  const AvlTree< size_t, std::string >& first = avltree.at(first_name);
+  const AvlTree< size_t, std::string >& second = avltree.at(last_name);
   for (auto it = first.cbegin(); it != first.cend(); ++it)
   {
     if (second.find(it->first) == second.cend())
@@ -80,15 +80,15 @@ void tkach::complement(std::istream& in, AvlTree< std::string, AvlTree< size_t,
   }
 }
 
-void tkach::unionTree(std::istream& in, AvlTree< std::string, AvlTree< size_t, std::string > >& avltree)
+void tkach::unionTree(std::istream& in, DataSets& avltree)
 {
   std::string new_name;
   std::string first_name;
   std::string last_name;
   in >> new_name >> first_name >> last_name;
   AvlTree< size_t, std::string > root;
-  const AvlTree< size_t, std::string > first = avltree.at(first_name);
-  const AvlTree< size_t, std::string > second = avltree.at(last_name);
+  const AvlTree< size_t, std::string >& first = avltree.at(first_name);
+  const AvlTree< size_t, std::string >& second = avltree.at(last_name);
   for (auto it = first.cbegin(); it != first.cend(); ++it)
   {
     root.insert({it->first, it->second});
@@ -6,10 +6,12 @@
 
 namespace tkach
 {
-  void print(std::istream& in, const AvlTree< std::string, AvlTree< size_t, std::string > >& avltree, std::ostream& out);
-  void intersect(std::istream& in, AvlTree< std::string, AvlTree< size_t, std::string > >& avltree);
-  void complement(std::istream& in, AvlTree< std::string, AvlTree< size_t, std::string > >& avltree);
-  void unionTree(std::istream& in, AvlTree< std::string, AvlTree< size_t, std::string > >& avltree);
+  using DataSets = AvlTree< std::string, AvlTree< size_t, std::string >, std::less<> >;
+
+  void print(std::istream& in, const DataSets& avltree, std::ostream& out);
+  void intersect(std::istream& in, DataSets& avltree);
+  void complement(std::istream& in, DataSets& avltree);
+  void unionTree(std::istream& in, DataSets& avltree);
 }
 
 #endif
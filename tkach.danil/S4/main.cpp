@@ -9,10 +9,10 @@
 
 namespace
 {
-  tkach::AvlTree< std::string, tkach::AvlTree< size_t, std::string > > inputDataSets(std::istream& in)
+  tkach::DataSets inputDataSets(std::istream& in)
   {
     using namespace tkach;
-    tkach::AvlTree< std::string, tkach::AvlTree< size_t, std::string > > fulldata;
+    tkach::DataSets fulldata;
     while(!in.eof())
     {
       AvlTree< size_t, std::string > temp;
@@ -46,7 +46,7 @@ int main(const int argc, const char* const* const argv)
     std::cerr << "File is not open\n";
     return 1;
   }
-  AvlTree< std::string, AvlTree< size_t, std::string > > data = inputDataSets(in);
+  DataSets data = inputDataSets(in);
   std::map< std::string, std::function< void() > > cmds;
   cmds["print"] = std::bind(print, std::ref(std::cin), std::cref(data), std::ref(std::cout));
   cmds["intersect"] = std::bind(intersect, std::ref(std::cin), std::ref(data));
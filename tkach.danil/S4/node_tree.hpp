@@ -10,22 +10,24 @@ namespace tkach
   struct TreeNode
   {
     template< class... Args >
-    TreeNode(Args... args);
+    TreeNode(Args&&... args);
     std::pair< Key, Value > data;
     TreeNode< Key, Value >* parent;
     TreeNode< Key, Value >* right;
     TreeNode< Key, Value >* left;
-    size_t height;
+    int height;
+    size_t subtree_size;
   };
 
   template< class Key, class Value >
   template< class... Args >
-  TreeNode< Key, Value >::TreeNode(Args... args):
+  TreeNode< Key, Value >::TreeNode(Args&&... args):
     data{std::pair< Key, Value >(std::forward< Args >(args)...)},
     parent(nullptr),
     right(nullptr),
     left(nullptr),
-    height(0)
+    height(1),
+    subtree_size(1)
   {}
 }
 
@@ -173,6 +173,24 @@ BOOST_AUTO_TEST_CASE(tree_find_test)
   BOOST_TEST((tree.find(5) != tree.end()));
 }
 
+BOOST_AUTO_TEST_CASE(tree_transparent_find_test)
+{
+  AvlTree< std::string, size_t, std::less<> > tree;
+  for (size_t i = 0; i < 30; ++i)
+  {
+    tree.insert(std::make_pair(std::to_string(i), i));
+  }
+  const char* name = "12";
+  BOOST_TEST(tree.at(name) == 12);
+  BOOST_TEST(tree.find("29")->second == 29);
+  BOOST_TEST((tree.find("30") == tree.end()));
+  BOOST_TEST(tree.count("3") == 1);
+  BOOST_TEST(tree.count("x") == 0);
+  BOOST_CHECK_THROW(tree.at("x"), std::out_of_range);
+  const AvlTree< std::string, size_t, std::less<> >& const_tree = tree;
+  BOOST_TEST(const_tree.at(std::string("7")) == 7);
+}
+
 BOOST_AUTO_TEST_CASE(tree_const_find_test)
 {
   AvlTree< size_t, std::string > tree;
@@ -401,3 +419,63 @@ BOOST_AUTO_TEST_CASE(tree_cend_test)
   }
   BOOST_TEST(i == 6);
 }
+
+BOOST_AUTO_TEST_CASE(tree_rank_select_test)
+{
+  AvlTree< size_t, std::string > tree;
+  for (size_t i = 0; i < 64; ++i)
+  {
+    size_t key = (i * 37) % 64 * 2;
+    tree.insert(std::make_pair(key, std::to_string(key)));
+  }
+  for (size_t i = 0; i < 64; i += 3)
+  {
+    tree.erase(i * 2);
+  }
+  const AvlTree< size_t, std::string >& ctree = tree;
+  size_t index = 0;
+  for (auto it = ctree.cbegin(); it != ctree.cend(); ++it, ++index)
+  {
+    BOOST_TEST((ctree.nth(index) == it));
+    BOOST_TEST(ctree.rank(it->first) == index);
+    BOOST_TEST(ctree.rank(it->first + 1) == index + 1);
+    BOOST_TEST(ctree.distance(ctree.cbegin(), it) == index);
+    BOOST_TEST(ctree.distance(it, ctree.cend()) == 42 - index);
+  }
+  BOOST_TEST(index == 42);
+  BOOST_TEST((tree.nth(42) == tree.end()));
+  BOOST_TEST(tree.nth(5)->first == 16);
+  BOOST_TEST(tree.distance(tree.begin(), tree.end()) == 42);
+}
+
+BOOST_AUTO_TEST_CASE(tree_insert_erase_mix_test)
+{
+  AvlTree< size_t, std::string > tree;
+  for (size_t i = 0; i < 200; ++i)
+  {
+    size_t key = (i * 73) % 200;
+    tree.insert(std::make_pair(key, std::to_string(key)));
+  }
+  tree.insert(std::make_pair(5, "duplicate"));
+  tree[7] = "seven";
+  BOOST_TEST(tree.size() == 200);
+  BOOST_TEST(tree.at(5) == "5");
+  BOOST_TEST((tree.erase(1000) == tree.end()));
+  BOOST_TEST(tree.size() == 200);
+  for (size_t i = 0; i < 200; i += 2)
+  {
+    auto it = tree.erase(tree.find(i));
+    BOOST_TEST((it->first == i + 1));
+  }
+  BOOST_TEST(tree.size() == 100);
+  size_t expected = 1;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it, expected += 2)
+  {
+    BOOST_TEST(it->first == expected);
+  }
+  tree.erase(tree.begin(), tree.nth(50));
+  BOOST_TEST(tree.size() == 50);
+  BOOST_TEST(tree.cbegin()->first == 101);
+  tree.clear();
+  BOOST_TEST(tree.empty());
+}
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -17,27 +18,44 @@ namespace zholobov {
         std::is_base_of<
             std::input_iterator_tag,
             typename std::iterator_traits< T >::iterator_category >::value >;
+
+    // Pooling allocators can drop all their nodes at once instead of one by one
+    template < typename A >
+    auto release_nodes(A& alloc, int) noexcept -> decltype(alloc.release())
+    {
+      return alloc.release();
+    }
+
+    template < typename A >
+    bool release_nodes(A&, long) noexcept
+    {
+      return false;
+    }
   }
 
-  template < typename T >
+  // DoublyLinked keeps a back link in every node so that pop_back is O(1)
+  // instead of a walk around the ring.
+  template < typename T, typename Alloc = std::allocator< T >, bool DoublyLinked = false >
   class CircularFwdList {
   public:
     using value_type = T;
+    using allocator_type = Alloc;
     using reference = value_type&;
     using const_reference = const value_type&;
     using iterator = CircularFwdListIterator< value_type >;
     using const_iterator = CircularFwdListConstIterator< value_type >;
 
     CircularFwdList();
-    explicit CircularFwdList(size_t n);
-    CircularFwdList(size_t n, const value_type& val);
-    CircularFwdList(std::initializer_list< value_type > init);
+    explicit CircularFwdList(const allocator_type& alloc);
+    explicit CircularFwdList(size_t n, const allocator_type& alloc = allocator_type());
+    CircularFwdList(size_t n, const value_type& val, const allocator_type& alloc = allocator_type());
+    CircularFwdList(std::initializer_list< value_type > init, const allocator_type& alloc = allocator_type());
 
     CircularFwdList(const CircularFwdList& other);
     CircularFwdList(CircularFwdList&& other) noexcept;
 
     template < typename InputIter, typename = details::IsInputIterator< InputIter > >
-    CircularFwdList(InputIter first, InputIter last);
+    CircularFwdList(InputIter first, InputIter last, const allocator_type& alloc = allocator_type());
 
     ~CircularFwdList();
 
@@ -50,6 +68,8 @@ namespace zholobov {
     void assign(size_t n, const T& val);
     void assign(std::initializer_list< T > init);
 
+    allocator_type get_allocator() const noexcept;
+
     iterator before_begin() noexcept;
     const_iterator before_begin() const noexcept;
     iterator begin() noexcept;
@@ -59,6 +79,9 @@ namespace zholobov {
     iterator end() noexcept;
     const_iterator end() const noexcept;
     const_iterator cend() const noexcept;
+    iterator before_end() noexcept;
+    const_iterator before_end() const noexcept;
+    const_iterator cbefore_end() const noexcept;
 
     reference front();
     const_reference front() const;
@@ -101,84 +124,108 @@ namespace zholobov {
     void clear() noexcept;
 
   private:
+    using node_type = std::conditional_t< DoublyLinked, DoublyLinkedNode< T >, FwdListNode< T > >;
+    using node_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< node_type >;
+    using node_traits = std::allocator_traits< node_allocator >;
+
     FwdListNodeBase* before_head_;
     FwdListNodeBase* head_;
     FwdListNodeBase* tail_;
     size_t size_;
+    node_allocator alloc_;
+
+    template < typename... Args >
+    FwdListNodeBase* create_node(Args&&... args);
+    void destroy_node(FwdListNodeBase* node) noexcept;
+    FwdListNodeBase* before_tail() const noexcept;
+    FwdListNodeBase* before_tail(std::true_type) const noexcept;
+    FwdListNodeBase* before_tail(std::false_type) const noexcept;
+    void link_after(FwdListNodeBase* node) noexcept;
+    void link_after(FwdListNodeBase* node, std::true_type) noexcept;
+    void link_after(FwdListNodeBase*, std::false_type) noexcept {}
   };
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList():
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::CircularFwdList():
+  CircularFwdList(allocator_type())
+{}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::CircularFwdList(const allocator_type& alloc):
   before_head_(reinterpret_cast< FwdListNodeBase* >(std::addressof(head_))),
   head_(nullptr),
   tail_(nullptr),
-  size_(0)
+  size_(0),
+  alloc_(alloc)
 {}
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(size_t n):
-  CircularFwdList(n, value_type())
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::CircularFwdList(size_t n, const allocator_type& alloc):
+  CircularFwdList(n, value_type(), alloc)
 {}
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(size_t n, const value_type& val):
-  CircularFwdList()
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::CircularFwdList(size_t n, const value_type& val, const allocator_type& alloc):
+  CircularFwdList(alloc)
 {
   for (size_t i = 0; i < n; ++i) {
     push_front(val);
   }
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(std::initializer_list< value_type > init):
-  CircularFwdList()
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::CircularFwdList(std::initializer_list< value_type > init,
+    const allocator_type& alloc):
+  CircularFwdList(alloc)
 {
   assign(init);
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(const CircularFwdList& other):
-  CircularFwdList()
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::CircularFwdList(const CircularFwdList& other):
+  CircularFwdList(node_traits::select_on_container_copy_construction(other.alloc_))
 {
   for (const auto& elem: other) {
     push_back(elem);
   }
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::CircularFwdList(CircularFwdList&& other) noexcept:
-  CircularFwdList()
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::CircularFwdList(CircularFwdList&& other) noexcept:
+  CircularFwdList(other.alloc_)
 {
   swap(other);
 }
 
-template < typename T >
+template < typename T, typename Alloc, bool DoublyLinked >
 template < typename InputIter, typename SFINAE >
-zholobov::CircularFwdList< T >::CircularFwdList(InputIter first, InputIter last):
-  CircularFwdList()
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::CircularFwdList(InputIter first, InputIter last, const allocator_type& alloc):
+  CircularFwdList(alloc)
 {
   assign(first, last);
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >::~CircularFwdList()
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::~CircularFwdList()
 {
   clear();
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >& zholobov::CircularFwdList< T >::operator=(const CircularFwdList& other)
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >&
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::operator=(const CircularFwdList& other)
 {
   if (this != std::addressof(other)) {
-    CircularFwdList< T > temp(other);
+    CircularFwdList temp(other);
     swap(temp);
   }
   return *this;
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >& zholobov::CircularFwdList< T >::operator=(CircularFwdList&& other) noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >&
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::operator=(CircularFwdList&& other) noexcept
 {
   if (this != std::addressof(other)) {
     clear();
@@ -187,165 +234,216 @@ zholobov::CircularFwdList< T >& zholobov::CircularFwdList< T >::operator=(Circul
   return *this;
 }
 
-template < typename T >
-zholobov::CircularFwdList< T >& zholobov::CircularFwdList< T >::operator=(std::initializer_list< value_type > init)
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >&
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::operator=(std::initializer_list< value_type > init)
 {
   assign(init);
   return *this;
 }
 
-template < typename T >
+template < typename T, typename Alloc, bool DoublyLinked >
 template < typename InputIter, typename SFINAE >
-void zholobov::CircularFwdList< T >::assign(InputIter first, InputIter last)
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::assign(InputIter first, InputIter last)
 {
-  CircularFwdList< T > temp;
+  CircularFwdList temp(get_allocator());
   for (; first != last; ++first) {
     temp.push_back(*first);
   }
   swap(temp);
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::assign(size_t n, const T& val)
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::assign(size_t n, const T& val)
 {
-  CircularFwdList< T > temp(n, val);
+  CircularFwdList temp(n, val, get_allocator());
   swap(temp);
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::assign(std::initializer_list< T > init)
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::assign(std::initializer_list< T > init)
 {
-  CircularFwdList< T > temp;
+  CircularFwdList temp(get_allocator());
   for (const auto& elem: init) {
     temp.push_back(elem);
   }
   swap(temp);
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator zholobov::CircularFwdList< T >::before_begin() noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::allocator_type
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::get_allocator() const noexcept
+{
+  return allocator_type(alloc_);
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::before_begin() noexcept
 {
   return iterator(std::addressof(before_head_));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::before_begin() const noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::before_begin() const noexcept
 {
   return cbefore_begin();
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator zholobov::CircularFwdList< T >::begin() noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::begin() noexcept
 {
   return iterator(std::addressof(head_));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::begin() const noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::begin() const noexcept
 {
   return cbegin();
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::cbefore_begin() const noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::cbefore_begin() const noexcept
 {
   return const_iterator(std::addressof(before_head_));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::cbegin() const noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::cbegin() const noexcept
 {
   return const_iterator(std::addressof(head_));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator zholobov::CircularFwdList< T >::end() noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::end() noexcept
 {
   return (size_ == 0) ? iterator(std::addressof(head_)) : iterator(std::addressof(tail_->next));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::end() const noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::end() const noexcept
 {
   return cend();
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_iterator zholobov::CircularFwdList< T >::cend() const noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::cend() const noexcept
 {
   return (size_ == 0) ? const_iterator(std::addressof(head_)) : const_iterator(std::addressof(tail_->next));
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::reference zholobov::CircularFwdList< T >::front()
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::before_end() noexcept
+{
+  return iterator(cbefore_end());
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::before_end() const noexcept
+{
+  return cbefore_end();
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::cbefore_end() const noexcept
+{
+  if (size_ == 0) {
+    return cbefore_begin();
+  } else if (size_ == 1) {
+    return cbegin();
+  }
+  return const_iterator(std::addressof(before_tail()->next));
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::reference
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::front()
 {
   return static_cast< FwdListNode< T >* >(head_)->value;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_reference zholobov::CircularFwdList< T >::front() const
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_reference
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::front() const
 {
   return static_cast< FwdListNode< T >* >(head_)->value;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::reference zholobov::CircularFwdList< T >::back()
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::reference
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::back()
 {
   return static_cast< FwdListNode< T >* >(tail_)->value;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::const_reference zholobov::CircularFwdList< T >::back() const
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::const_reference
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::back() const
 {
   return static_cast< FwdListNode< T >* >(tail_)->value;
 }
 
-template < typename T >
-bool zholobov::CircularFwdList< T >::empty() const noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+bool zholobov::CircularFwdList< T, Alloc, DoublyLinked >::empty() const noexcept
 {
   return size_ == 0;
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::push_front(const value_type& val)
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::push_front(const value_type& val)
 {
   push_front(value_type(val));
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::push_front(value_type&& val)
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::push_front(value_type&& val)
 {
-  auto new_node = new FwdListNode< value_type >(std::move(val), head_);
+  auto new_node = create_node(std::move(val), head_);
   head_ = new_node;
   if (size_ == 0) {
     tail_ = head_;
   }
   tail_->next = head_;
+  link_after(head_);
+  link_after(tail_);
   ++size_;
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::push_back(const value_type& val)
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::push_back(const value_type& val)
 {
   push_back(value_type(val));
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::push_back(value_type&& val)
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::push_back(value_type&& val)
 {
-  auto new_node = new FwdListNode< value_type >(std::move(val), head_);
+  auto new_node = create_node(std::move(val), head_);
   if (size_ == 0) {
     head_ = new_node;
     head_->next = head_;
   } else {
     tail_->next = new_node;
+    link_after(tail_);
   }
   tail_ = new_node;
+  link_after(tail_);
   ++size_;
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::pop_front()
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::pop_front()
 {
   FwdListNodeBase* temp = head_;
   if (size_ == 0) {
@@ -356,67 +454,83 @@ void zholobov::CircularFwdList< T >::pop_front()
   } else {
     head_ = head_->next;
     tail_->next = head_;
+    link_after(tail_);
+  }
+  destroy_node(temp);
+  --size_;
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::pop_back()
+{
+  if (size_ < 2) {
+    pop_front();
+    return;
   }
-  delete temp;
+  FwdListNodeBase* temp = tail_;
+  tail_ = before_tail();
+  tail_->next = head_;
+  link_after(tail_);
+  destroy_node(temp);
   --size_;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, const T& x)
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::insert_after(const_iterator position, const T& x)
 {
-  CircularFwdList< T > list(1, x);
+  CircularFwdList list(1, x, get_allocator());
   splice_after(position, list);
   return ++iterator(position);
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, T&& x)
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::insert_after(const_iterator position, T&& x)
 {
-  CircularFwdList< T > list;
+  CircularFwdList list(get_allocator());
   list.push_back(std::move(x));
   splice_after(position, list);
   return ++iterator(position);
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, size_t n, const T& x)
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::insert_after(const_iterator position, size_t n, const T& x)
 {
-  CircularFwdList< T > list(n, x);
+  CircularFwdList list(n, x, get_allocator());
   splice_after(position, list);
   auto result = iterator(position);
   std::advance(result, n);
   return result;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, std::initializer_list< T > il)
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::insert_after(const_iterator position, std::initializer_list< T > il)
 {
-  CircularFwdList< T > list(il);
+  CircularFwdList list(il, get_allocator());
   splice_after(position, list);
   auto result = iterator(position);
   std::advance(result, il.size());
   return result;
 }
 
-template < typename T >
+template < typename T, typename Alloc, bool DoublyLinked >
 template < class InputIter, typename SFINAE >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::insert_after(const_iterator position, InputIter first, InputIter last)
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::insert_after(const_iterator position, InputIter first, InputIter last)
 {
-  CircularFwdList< T > list(first, last);
+  CircularFwdList list(first, last, get_allocator());
   splice_after(position, list);
   auto result = iterator(position);
   std::advance(result, std::distance(first, last));
   return result;
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::erase_after(const_iterator position)
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::erase_after(const_iterator position)
 {
   auto last = position;
   if (++last == cend()) {
@@ -426,26 +540,26 @@ zholobov::CircularFwdList< T >::erase_after(const_iterator position)
   return erase_after(position, last);
 }
 
-template < typename T >
-typename zholobov::CircularFwdList< T >::iterator
-zholobov::CircularFwdList< T >::erase_after(const_iterator position, const_iterator last)
+template < typename T, typename Alloc, bool DoublyLinked >
+typename zholobov::CircularFwdList< T, Alloc, DoublyLinked >::iterator
+zholobov::CircularFwdList< T, Alloc, DoublyLinked >::erase_after(const_iterator position, const_iterator last)
 {
-  CircularFwdList< T > tmp;
+  CircularFwdList tmp(get_allocator());
   tmp.splice_after(tmp.cbefore_begin(), *this, position, last);
   return ++iterator(position);
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::remove(const value_type& val)
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::remove(const value_type& val)
 {
   remove_if([&val](const T& value) {
     return value == val;
   });
 }
 
-template < typename T >
+template < typename T, typename Alloc, bool DoublyLinked >
 template < class Predicate >
-void zholobov::CircularFwdList< T >::remove_if(Predicate pred)
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::remove_if(Predicate pred)
 {
   while (head_ != nullptr && (pred(static_cast< FwdListNode< T >* >(head_)->value))) {
     pop_front();
@@ -459,7 +573,8 @@ void zholobov::CircularFwdList< T >::remove_if(Predicate pred)
         if (temp == tail_) {
           tail_ = p;
         }
-        delete temp;
+        link_after(p);
+        destroy_node(temp);
         --size_;
       } else {
         p = p->next;
@@ -468,65 +583,78 @@ void zholobov::CircularFwdList< T >::remove_if(Predicate pred)
   }
 }
 
-template < typename T >
+template < typename T, typename Alloc, bool DoublyLinked >
 template < typename List >
-void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& other)
-{
-  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T > >::value, "Invalid list type");
-  if (!other.empty()) {
-    FwdListNodeBase* p = before_head_;
-    const_iterator it = cbefore_begin();
-    while ((it != cend()) && (it != pos)) {
-      ++it;
-      p = p->next;
-    }
-    if (it != cend()) {
-      other.tail_->next = p->next;
-      p->next = other.head_;
-      if (p == tail_) {
-        tail_ = other.tail_;
-      }
-      tail_->next = head_;
-      other.head_ = nullptr;
-      other.tail_ = nullptr;
-      size_ += other.size_;
-      other.size_ = 0;
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::splice_after(const_iterator pos, List&& other)
+{
+  static_assert(std::is_same< std::decay_t< List >, CircularFwdList >::value, "Invalid list type");
+  if (!other.empty() && (pos != cend())) {
+    FwdListNodeBase* p = *pos.node_;
+    other.tail_->next = p->next;
+    p->next = other.head_;
+    if ((p == tail_) || (size_ == 0)) {
+      tail_ = other.tail_;
     }
+    link_after(p);
+    link_after(other.tail_);
+    tail_->next = head_;
+    link_after(tail_);
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    size_ += other.size_;
+    other.size_ = 0;
   }
 }
 
-template < typename T >
+template < typename T, typename Alloc, bool DoublyLinked >
 template < typename List >
-void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& other, const_iterator it)
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::splice_after(const_iterator pos, List&& other, const_iterator it)
 {
-  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T > >::value, "Invalid list type");
-  FwdListNodeBase* p = before_head_;
-  const_iterator this_it = cbefore_begin();
-  while ((this_it != cend()) && (this_it != pos)) {
-    ++this_it;
-    p = p->next;
-  }
-  if (this_it != cend()) {
-    FwdListNodeBase** other_p = std::addressof(other.head_);
-    const_iterator other_it = other.cbegin();
-    while ((other_it != other.cend()) && (other_it != it)) {
-      ++other_it;
-      other_p = std::addressof((*other_p)->next);
-    }
+  static_assert(std::is_same< std::decay_t< List >, CircularFwdList >::value, "Invalid list type");
+  if ((pos != cend()) && (it != other.cend())) {
+    FwdListNodeBase* p = *pos.node_;
+    FwdListNodeBase** other_p = it.node_;
+    FwdListNodeBase* other_prev = reinterpret_cast< FwdListNodeBase* >(other_p);
     FwdListNodeBase* tmp = *other_p;
     *other_p = tmp->next;
-    tmp->next = p->next;
-    p->next = tmp;
-    --other.size_;
+    if (--other.size_ == 0) {
+      other.head_ = nullptr;
+      other.tail_ = nullptr;
+    } else {
+      if (tmp == other.head_) {
+        other.head_ = tmp->next;
+      }
+      if (tmp == other.tail_) {
+        other.tail_ = other_prev;
+      }
+      link_after(other_prev);
+      other.tail_->next = other.head_;
+      link_after(other.tail_);
+    }
+
+    if (size_ == 0) {
+      head_ = tmp;
+      tail_ = tmp;
+    } else {
+      tmp->next = p->next;
+      p->next = tmp;
+      if (p == tail_) {
+        tail_ = tmp;
+      }
+    }
+    tail_->next = head_;
+    link_after(p);
+    link_after(tmp);
+    link_after(tail_);
     ++size_;
   }
 }
 
-template < typename T >
+template < typename T, typename Alloc, bool DoublyLinked >
 template < typename List >
-void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& other, const_iterator first, const_iterator last)
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::splice_after(const_iterator pos, List&& other, const_iterator first, const_iterator last)
 {
-  static_assert(std::is_same< std::decay_t< List >, CircularFwdList< T > >::value, "Invalid list type");
+  static_assert(std::is_same< std::decay_t< List >, CircularFwdList >::value, "Invalid list type");
   FwdListNodeBase** pos_p = pos.node_;
   FwdListNodeBase** first_p = first.node_;
   FwdListNodeBase** last_p = last.node_;
@@ -536,51 +664,115 @@ void zholobov::CircularFwdList< T >::splice_after(const_iterator pos, List&& oth
     if (last == other.cend()) {
       other.tail_ = *first_p;
     }
-    if (pos == cbefore_begin()) {
-      head_ = (*first_p)->next;
-    }
     if (++pos == cend()) {
       tail_ = reinterpret_cast< FwdListNodeBase* >(last_p);
     }
 
     FwdListNodeBase* keep = (*pos_p)->next;
-    (*pos_p)->next = (*first_p)->next;
+    FwdListNodeBase* moved = (*first_p)->next;
     (*first_p)->next = *last_p;
+    link_after(*first_p);
+    (*pos_p)->next = moved;
+    link_after(*pos_p);
     *last_p = keep;
+    link_after(reinterpret_cast< FwdListNodeBase* >(last_p));
     size_ += count;
     other.size_ -= count;
     tail_->next = head_;
+    link_after(tail_);
     if (other.size_ == 0) {
       other.head_ = nullptr;
       other.tail_ = nullptr;
     } else {
       other.tail_->next = other.head_;
+      link_after(other.tail_);
     }
   }
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::swap(CircularFwdList& other) noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::swap(CircularFwdList& other) noexcept
 {
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(size_, other.size_);
+  std::swap(alloc_, other.alloc_);
 }
 
-template < typename T >
-void zholobov::CircularFwdList< T >::clear() noexcept
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::clear() noexcept
 {
-  if (size_ != 0) {
+  bool released = std::is_trivially_destructible< T >::value && details::release_nodes(alloc_, 0);
+  if ((size_ != 0) && !released) {
     FwdListNodeBase* curr = head_;
     do {
       FwdListNodeBase* temp = curr;
       curr = curr->next;
-      delete static_cast< FwdListNode< T >* >(temp);
+      destroy_node(temp);
     } while (curr != head_);
+    details::release_nodes(alloc_, 0);
   }
   head_ = nullptr;
   tail_ = nullptr;
   size_ = 0;
 }
 
+template < typename T, typename Alloc, bool DoublyLinked >
+template < typename... Args >
+zholobov::FwdListNodeBase* zholobov::CircularFwdList< T, Alloc, DoublyLinked >::create_node(Args&&... args)
+{
+  node_type* node = node_traits::allocate(alloc_, 1);
+  try {
+    node_traits::construct(alloc_, node, std::forward< Args >(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::destroy_node(FwdListNodeBase* node) noexcept
+{
+  node_type* value_node = static_cast< node_type* >(node);
+  node_traits::destroy(alloc_, value_node);
+  node_traits::deallocate(alloc_, value_node, 1);
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::FwdListNodeBase* zholobov::CircularFwdList< T, Alloc, DoublyLinked >::before_tail() const noexcept
+{
+  return before_tail(std::integral_constant< bool, DoublyLinked >());
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::FwdListNodeBase* zholobov::CircularFwdList< T, Alloc, DoublyLinked >::before_tail(std::true_type) const noexcept
+{
+  return static_cast< node_type* >(tail_)->prev;
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+zholobov::FwdListNodeBase* zholobov::CircularFwdList< T, Alloc, DoublyLinked >::before_tail(std::false_type) const noexcept
+{
+  FwdListNodeBase* p = head_;
+  while (p->next != tail_) {
+    p = p->next;
+  }
+  return p;
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::link_after(FwdListNodeBase* node) noexcept
+{
+  link_after(node, std::integral_constant< bool, DoublyLinked >());
+}
+
+template < typename T, typename Alloc, bool DoublyLinked >
+void zholobov::CircularFwdList< T, Alloc, DoublyLinked >::link_after(FwdListNodeBase* node, std::true_type) noexcept
+{
+  if (node->next != nullptr) {
+    static_cast< node_type* >(node->next)->prev = node;
+  }
+}
+
 #endif
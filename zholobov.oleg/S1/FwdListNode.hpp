@@ -48,6 +48,13 @@ namespace zholobov {
     {}
   };
 
+  template < typename T >
+  struct DoublyLinkedNode: public FwdListNode< T > {
+    using FwdListNode< T >::FwdListNode;
+
+    FwdListNodeBase* prev = nullptr;
+  };
+
 }
 
 #endif
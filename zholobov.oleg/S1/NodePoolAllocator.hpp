@@ -0,0 +1,176 @@
+#ifndef NODEPOOLALLOCATOR_HPP
+#define NODEPOOLALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace zholobov {
+
+  namespace details {
+
+    // Free-list slab allocator for single nodes. Slabs are chained through their first slot
+    // and are only returned to the system all at once.
+    class NodePool {
+    public:
+      static constexpr size_t first_slab_slots = 16;
+      static constexpr size_t max_slab_slots = 4096;
+
+      NodePool() = default;
+      NodePool(const NodePool&) = delete;
+      NodePool& operator=(const NodePool&) = delete;
+      ~NodePool() { release(); }
+
+      void* allocate(size_t size)
+      {
+        if (slot_size_ == 0) {
+          slot_size_ = roundUp(size);
+        }
+        if (free_ != nullptr) {
+          Slot* slot = free_;
+          free_ = slot->next;
+          return slot;
+        }
+        if (bump_ == bump_end_) {
+          addSlab();
+        }
+        void* result = bump_;
+        bump_ += slot_size_;
+        return result;
+      }
+
+      void deallocate(void* p) noexcept
+      {
+        Slot* slot = static_cast< Slot* >(p);
+        slot->next = free_;
+        free_ = slot;
+      }
+
+      bool fits(size_t size) const noexcept
+      {
+        return (slot_size_ == 0) || (roundUp(size) == slot_size_);
+      }
+
+      void release() noexcept
+      {
+        while (slabs_ != nullptr) {
+          Slot* next = slabs_->next;
+          ::operator delete(slabs_);
+          slabs_ = next;
+        }
+        free_ = nullptr;
+        bump_ = nullptr;
+        bump_end_ = nullptr;
+        next_slab_slots_ = first_slab_slots;
+      }
+
+    private:
+      struct Slot {
+        Slot* next;
+      };
+
+      static constexpr size_t alignment = alignof(std::max_align_t);
+
+      static size_t roundUp(size_t size) noexcept
+      {
+        return (size + alignment - 1) / alignment * alignment;
+      }
+
+      void addSlab()
+      {
+        size_t header = roundUp(sizeof(Slot));
+        char* slab = static_cast< char* >(::operator new(header + next_slab_slots_ * slot_size_));
+        reinterpret_cast< Slot* >(slab)->next = slabs_;
+        slabs_ = reinterpret_cast< Slot* >(slab);
+        bump_ = slab + header;
+        bump_end_ = bump_ + next_slab_slots_ * slot_size_;
+        if (next_slab_slots_ < max_slab_slots) {
+          next_slab_slots_ *= 2;
+        }
+      }
+
+      Slot* slabs_ = nullptr;
+      Slot* free_ = nullptr;
+      char* bump_ = nullptr;
+      char* bump_end_ = nullptr;
+      size_t slot_size_ = 0;
+      size_t next_slab_slots_ = first_slab_slots;
+    };
+
+    constexpr size_t NodePool::first_slab_slots;
+    constexpr size_t NodePool::max_slab_slots;
+  }
+
+  // Copies and rebinds of an allocator share one pool, so containers built from the same
+  // allocator may splice nodes between each other. The pool serves a single node size;
+  // any other request goes to operator new.
+  template < typename T >
+  class NodePoolAllocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    NodePoolAllocator():
+      pool_(std::make_shared< details::NodePool >())
+    {}
+
+    template < typename U >
+    NodePoolAllocator(const NodePoolAllocator< U >& other) noexcept:
+      pool_(other.pool_)
+    {}
+
+    T* allocate(size_t n)
+    {
+      if ((n == 1) && pool_->fits(sizeof(T))) {
+        return static_cast< T* >(pool_->allocate(sizeof(T)));
+      }
+      return static_cast< T* >(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+      if ((n == 1) && pool_->fits(sizeof(T))) {
+        pool_->deallocate(p);
+      } else {
+        ::operator delete(p);
+      }
+    }
+
+    // Drops every slab at once if no other allocator shares the pool. The caller must
+    // not touch any node it got from this pool afterwards.
+    bool release() noexcept
+    {
+      if (pool_.use_count() != 1) {
+        return false;
+      }
+      pool_->release();
+      return true;
+    }
+
+    template < typename U >
+    bool operator==(const NodePoolAllocator< U >& other) const noexcept
+    {
+      return pool_ == other.pool_;
+    }
+
+    template < typename U >
+    bool operator!=(const NodePoolAllocator< U >& other) const noexcept
+    {
+      return !(*this == other);
+    }
+
+  private:
+    std::shared_ptr< details::NodePool > pool_;
+
+    template < typename U >
+    friend class NodePoolAllocator;
+  };
+
+}
+
+#endif
@@ -3,9 +3,10 @@
 #include <sstream>
 
 #include "CircularFwdList.hpp"
+#include "NodePoolAllocator.hpp"
 
-template < typename T >
-std::string to_string(const zholobov::CircularFwdList< T >& list)
+template < typename T, typename Alloc, bool DoublyLinked >
+std::string to_string(const zholobov::CircularFwdList< T, Alloc, DoublyLinked >& list)
 {
   std::stringstream ss;
   if (list.size() != 0) {
@@ -204,6 +205,30 @@ BOOST_AUTO_TEST_CASE(push_pop_back)
   list.push_back(11);
   BOOST_TEST(list.size() == 2);
   BOOST_TEST(to_string(list) == "10 11");
+  list.push_back(12);
+  list.pop_back();
+  BOOST_TEST(list.back() == 11);
+  BOOST_TEST(to_string(list) == "10 11");
+  list.pop_back();
+  list.pop_back();
+  BOOST_TEST(list.empty());
+  BOOST_TEST(to_string(list) == "");
+}
+
+BOOST_AUTO_TEST_CASE(doubly_linked_pop_back)
+{
+  zholobov::CircularFwdList< int, std::allocator< int >, true > list{1, 2, 3};
+  list.push_front(0);
+  list.remove(2);
+  BOOST_TEST(to_string(list) == "0 1 3");
+  list.pop_back();
+  BOOST_TEST(list.back() == 1);
+  list.push_back(4);
+  list.pop_back();
+  list.pop_back();
+  BOOST_TEST(to_string(list) == "0");
+  list.pop_back();
+  BOOST_TEST(list.empty());
 }
 
 BOOST_AUTO_TEST_CASE(swap)
@@ -498,6 +523,79 @@ BOOST_AUTO_TEST_CASE(splice_after)
     BOOST_TEST(to_string(list1) == "1 2 3 40 50 60");
     BOOST_TEST(to_string(list2) == "10 20 30");
   }
+  {
+    zholobov::CircularFwdList< int > list1{1, 2};
+    zholobov::CircularFwdList< int > list2{10, 20, 30};
+    list1.splice_after(list1.cbefore_begin(), list2, list2.cbefore_begin(), list2.cend());
+    BOOST_TEST(to_string(list1) == "10 20 30 1 2");
+    BOOST_TEST(to_string(list2) == "");
+  }
+  {
+    zholobov::CircularFwdList< int > list1{1, 2};
+    zholobov::CircularFwdList< int > list2{10, 20, 30};
+    list1.splice_after(list1.cbegin(), list2, std::next(list2.cbegin(), 2));
+    BOOST_TEST(to_string(list1) == "1 30 2");
+    BOOST_TEST(to_string(list2) == "10 20");
+    list2.push_back(40);
+    BOOST_TEST(to_string(list2) == "10 20 40");
+  }
+  {
+    zholobov::CircularFwdList< int, std::allocator< int >, true > list1{1, 2};
+    zholobov::CircularFwdList< int, std::allocator< int >, true > list2{10, 20};
+    list1.splice_after(list1.cbefore_end(), list2);
+    BOOST_TEST(to_string(list1) == "1 2 10 20");
+    list1.pop_back();
+    list1.pop_back();
+    list1.pop_back();
+    BOOST_TEST(to_string(list1) == "1");
+    list1.splice_after(list1.cbefore_end(), list2);
+    BOOST_TEST(list2.empty());
+    list1.pop_back();
+    list1.splice_after(list1.cbefore_end(), zholobov::CircularFwdList< int, std::allocator< int >, true >{5, 6});
+    BOOST_TEST(to_string(list1) == "5 6");
+    BOOST_TEST(list1.back() == 6);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(CircularFwsList_NodePool)
+
+BOOST_AUTO_TEST_CASE(shared_pool)
+{
+  using PooledList = zholobov::CircularFwdList< int, zholobov::NodePoolAllocator< int > >;
+  zholobov::NodePoolAllocator< int > alloc;
+  PooledList list1({1, 2, 3}, alloc);
+  PooledList list2({10, 20, 30, 40}, alloc);
+  BOOST_TEST((list1.get_allocator() == list2.get_allocator()));
+  list1.splice_after(list1.cbegin(), list2, list2.cbegin(), list2.cend());
+  BOOST_TEST(to_string(list1) == "1 20 30 40 2 3");
+  BOOST_TEST(to_string(list2) == "10");
+  list2.clear();
+  list1.erase_after(list1.cbegin());
+  list1.insert_after(list1.cbefore_begin(), {7, 8});
+  list1.push_back(9);
+  BOOST_TEST(to_string(list1) == "7 8 1 30 40 2 3 9");
+  PooledList list3(list1);
+  list1.clear();
+  BOOST_TEST(list1.empty());
+  BOOST_TEST(to_string(list3) == "7 8 1 30 40 2 3 9");
+}
+
+BOOST_AUTO_TEST_CASE(clear_releases_slabs)
+{
+  using PooledList = zholobov::CircularFwdList< std::string, zholobov::NodePoolAllocator< std::string > >;
+  PooledList list;
+  for (int i = 0; i < 100; ++i) {
+    list.push_back(std::string(40, static_cast< char >('a' + i % 26)));
+  }
+  list.remove_if([](const std::string& value) { return value[0] == 'a'; });
+  BOOST_TEST(list.size() == 96);
+  list.clear();
+  BOOST_TEST(list.empty());
+  list.push_front("x");
+  list.push_back("y");
+  BOOST_TEST(to_string(list) == "x y");
 }
 
 BOOST_AUTO_TEST_SUITE_END()